@@ -1,7 +1,15 @@
 #include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/mapped_file.hpp>
+#include <bondrewd/lex/source_manager.hpp>
+#include <bondrewd/ast/ast.hpp>
+#include <bondrewd/ast/flat_cache.hpp>
+#include <bondrewd/parse/parser.gen.hpp>
 
 #include <boost/program_options.hpp>
 #include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <optional>
 
 #include "demo_lexer.hpp"
 #include "demo_parser.hpp"
@@ -19,13 +27,22 @@ auto parse_args(int argc, char **argv) {
         ("help", "produce help message")
         ("verbosity", prog_opts::value<int>()->default_value(0)->implicit_value(1), "set verbosity level")
         ("test", prog_opts::bool_switch(), "run a debug test")
+        ("arena-stats", prog_opts::bool_switch(), "dump AST arena memory statistics before exiting")
+        ("input", prog_opts::value<std::string>(), "source file to parse ('-' for stdin)")
+        ("ast-cache", prog_opts::value<std::string>(), "reuse the parsed AST from this file if the source is unchanged, and update it otherwise")
+        ("dump-ast", prog_opts::bool_switch(), "dump the parsed AST")
+        ("lex-jobs", prog_opts::value<unsigned>()->implicit_value(0), "lex the whole file before parsing, on this many threads (0 or no value for one per core)")
+        ("rule-profile", prog_opts::value<std::string>(), "write the parser's rule profile to this file, for pegenxx.py --memo-profile (needs a BONDREWD_PARSER_PROFILE build)")
     ;
 
+    prog_opts::positional_options_description positional{};
+    positional.add("input", 1);
+
     prog_opts::variables_map args{};
     try {
         prog_opts::store(
             prog_opts::command_line_parser(argc, argv)
-                .options(desc).run(),
+                .options(desc).positional(positional).run(),
             args
         );
         prog_opts::notify(args);
@@ -54,6 +71,92 @@ void run_test() {
 }
 
 
+void save_profile([[maybe_unused]] const bondrewd::parse::Parser &parser, const std::filesystem::path &path) {
+#if BONDREWD_PARSER_PROFILE
+    std::ofstream output{path};
+    parser.get_profile().dump(output);
+#else
+    std::cerr << "Warning: no rule profile written to " << path << ", since profiling is disabled in this build\n";
+#endif
+}
+
+
+void process_stdin(const std::optional<std::filesystem::path> &profile_path, bool dump) {
+    using namespace bondrewd;
+
+    // Streamed, so that parsing can start before the input is complete
+    auto parser = parse::Parser::from_stream(std::cin, "<stdin>");
+
+    auto tree = ast::flat::flatten(parser.parse());
+
+    if (profile_path) {
+        save_profile(parser, *profile_path);
+    }
+
+    if (dump) {
+        tree.dump();
+    }
+}
+
+
+void process_file(const std::filesystem::path &input, const std::optional<std::filesystem::path> &cache_path,
+                  std::optional<unsigned> lex_jobs, const std::optional<std::filesystem::path> &profile_path, bool dump) {
+    using namespace bondrewd;
+
+    if (input == "-") {
+        if (cache_path) {
+            std::cerr << "Warning: the AST cache isn't used for stdin\n";
+        }
+
+        if (lex_jobs) {
+            std::cerr << "Warning: --lex-jobs isn't used for stdin, since it's streamed\n";
+        }
+
+        return process_stdin(profile_path, dump);
+    }
+
+    lex::LoadedSource source{lex::SourceManager::instance, lex::SourceManager::instance.load_file(input)};
+    uint64_t source_hash = ast::flat::hash_source(source->view());
+
+    if (cache_path) {
+        if (auto cached = ast::flat::MappedTree::open(*cache_path, parse::Parser::grammar_hash, source_hash)) {
+            DBG("Reusing the cached AST from %s", cache_path->string().c_str());
+
+            if (profile_path) {
+                std::cerr << "Warning: no rule profile written to " << *profile_path << ", since the AST was reused from the cache\n";
+            }
+
+            if (dump) {
+                cached->dump();
+            }
+
+            return;
+        }
+    }
+
+    auto parser = lex_jobs ? parse::Parser::from_buffer_pretokenized(source.get(), *lex_jobs)
+                           : parse::Parser::from_buffer(source.get());
+
+    auto tree = ast::flat::flatten(parser.parse());
+
+    if (profile_path) {
+        save_profile(parser, *profile_path);
+    }
+
+    if (cache_path) {
+        try {
+            ast::flat::save_cache(tree, parse::Parser::grammar_hash, source_hash, *cache_path);
+        } catch (const ast::flat::CacheError &e) {
+            std::cerr << "Warning: " << e.what() << "\n";
+        }
+    }
+
+    if (dump) {
+        tree.dump();
+    }
+}
+
+
 }  // namespace
 #pragma endregion Helpers
 
@@ -66,9 +169,43 @@ int main(int argc, char **argv) {
 
     bondrewd::util::log_verbosity = args["verbosity"].as<int>();
 
-    if (args.count("test")) {
+    if (args["test"].as<bool>()) {
         run_test();
     }
 
+    if (args.count("input")) {
+        std::optional<std::filesystem::path> cache_path{};
+        if (args.count("ast-cache")) {
+            cache_path = args["ast-cache"].as<std::string>();
+        }
+
+        std::optional<unsigned> lex_jobs{};
+        if (args.count("lex-jobs")) {
+            lex_jobs = args["lex-jobs"].as<unsigned>();
+        }
+
+        std::optional<std::filesystem::path> profile_path{};
+        if (args.count("rule-profile")) {
+            profile_path = args["rule-profile"].as<std::string>();
+        }
+
+        try {
+            process_file(args["input"].as<std::string>(), cache_path, lex_jobs, profile_path, args["dump-ast"].as<bool>());
+        } catch (const bondrewd::util::FileError &e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        } catch (const bondrewd::lex::LexicalError &e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        } catch (const bondrewd::parse::SyntaxError &e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    if (args["arena-stats"].as<bool>()) {
+        bondrewd::ast::ast_arena.dump_stats(std::cerr);
+    }
+
     return 0;
 }
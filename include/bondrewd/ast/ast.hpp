@@ -2,6 +2,7 @@
 
 #include <bondrewd/internal/common.hpp>
 #include <bondrewd/internal/arena.hpp>
+#include <bondrewd/internal/symbol.hpp>
 
 #include <vector>
 #include <variant>
@@ -19,8 +20,67 @@
 namespace bondrewd::ast {
 
 
+#pragma region Ownership mode
+/**
+ * When enabled, AST fields and sequences are plain non-owning pointers into
+ * the current AST arena's region, instead of reference-counted arena_ptr's. Copying them
+ * is free, and nothing is destroyed until `ast_arena.reset()`. Almost every node
+ * has exactly one parent, so refcounting buys little for the AST itself.
+ */
+#ifndef BONDREWD_AST_REGION_OWNED
+#define BONDREWD_AST_REGION_OWNED 0
+#endif
+#pragma endregion Ownership mode
+
+
 #pragma region Arena
-extern util::Arena ast_arena;
+/**
+ * The default arena AST nodes live in. Each thread has its own.
+ *
+ * Nodes are carved out of its region, so a whole parse tree can be dropped
+ * in one go with `ast_arena.reset()`, once the compilation unit is no longer needed.
+ */
+extern thread_local util::Arena ast_arena;
+
+/**
+ * The arena new AST nodes are currently allocated in, on this thread.
+ *
+ * That's `ast_arena`, unless overridden by an ASTArenaScope.
+ */
+util::Arena &current_ast_arena() noexcept;
+
+/**
+ * Redirects AST allocations on this thread into the given arena, for as long as it lives.
+ *
+ * This allows to keep a separate arena per compilation unit, e.g. in a worker pool
+ * parsing many files in parallel. Scopes may be nested.
+ */
+class ASTArenaScope {
+public:
+    #pragma region Constructors
+    explicit ASTArenaScope(util::Arena &arena);
+    #pragma endregion Constructors
+
+    #pragma region Destructor
+    ~ASTArenaScope();
+    #pragma endregion Destructor
+
+    #pragma region Service constructors
+    ASTArenaScope(const ASTArenaScope &) = delete;
+    ASTArenaScope(ASTArenaScope &&) = delete;
+    ASTArenaScope &operator=(const ASTArenaScope &) = delete;
+    ASTArenaScope &operator=(ASTArenaScope &&) = delete;
+    #pragma endregion Service constructors
+
+protected:
+    #pragma region Fields
+    util::Arena *prev;
+    #pragma endregion Fields
+
+};
+
+template <typename T>
+using ast_allocator = util::region_allocator<T>;
 #pragma endregion Arena
 
 
@@ -86,11 +146,14 @@ template <typename T>
 concept concrete_ast_node = std::derived_from<std::decay_t<T>, _ConcreteASTNode>;
 
 template <typename T>
-concept is_sequence = util::arena_ptr_at<T, &ast_arena>
+concept is_ast_ptr = util::is_arena_ptr<T> || util::is_region_ptr<T>;
+
+template <typename T>
+concept is_sequence = is_ast_ptr<T>
     && util::specialization_of<typename T::element_type, std::vector>;
 
 template <typename T>
-concept is_field = util::arena_ptr_at<T, &ast_arena> && !is_sequence<T>;
+concept is_field = is_ast_ptr<T> && !is_sequence<T>;
 
 template <typename T>
 concept is_maybe = is_field<T>;
@@ -98,23 +161,45 @@ concept is_maybe = is_field<T>;
 
 
 #pragma region Convenience aliases
+#pragma region ast_ptr
+#if BONDREWD_AST_REGION_OWNED
+template <typename T>
+using ast_ptr = util::region_ptr<T>;
+
+template <typename T, typename ... As>
+ast_ptr<T> make_ast_ptr(As &&... args) {
+    return util::make_region_ptr<T>(current_ast_arena(), std::forward<As>(args)...);
+}
+#else
+template <typename T>
+using ast_ptr = util::arena_ptr<T>;
+
+template <typename T, typename ... As>
+ast_ptr<T> make_ast_ptr(As &&... args) {
+    return util::make_arena_ptr<T, ast_allocator<T>>(current_ast_arena(), std::forward<As>(args)...);
+}
+#endif
+#pragma endregion ast_ptr
+
 #pragma region field
 template <typename T>
-using field = util::arena_ptr<T, &ast_arena>;
+using field = ast_ptr<T>;
 
 template <typename T, typename ... As>
 field<T> make_field(As &&... args) {
-    return util::make_arena_ptr<T, &ast_arena>(std::forward<As>(args)...);
+    return make_ast_ptr<T>(std::forward<As>(args)...);
 }
 #pragma endregion field
 
 #pragma region sequence
 template <typename T>
-using sequence = util::arena_ptr<std::vector<T>, &ast_arena>;
+using sequence = ast_ptr<std::vector<T>>;
 
 template <typename T, typename ... As>
 sequence<T> make_sequence(As &&... args) {
-    return util::make_arena_ptr<std::vector<T>, &ast_arena>(std::forward<As>(args)...);
+    // Note: only the vector object itself lives in the region; its storage is still
+    // heap-allocated, since growing vectors would waste region space on every reallocation.
+    return make_ast_ptr<std::vector<T>>(std::forward<As>(args)...);
 }
 #pragma endregion sequence
 
@@ -157,7 +242,8 @@ maybe<T> make_maybe(std::optional<T> value) {
 #pragma region ASDL basic types
 // Types that match the C++ built-in ones aren't redefined here
 
-using identifier = std::string;
+/// Identifiers are interned in util::SymbolTable::instance, same as NAME tokens
+using identifier = util::Symbol;
 
 // TODO: Temporary! Will be replaced with a compile-time object type
 // Monostate represents unit for now
@@ -0,0 +1,2107 @@
+// AUTOGENERATED by bondrewd/tools/asdl++/asdl_cpp.py on 2026-10-17 10:04:54
+// DO NOT EDIT
+
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/ast/ast.hpp>
+#include <bondrewd/ast/flat.hpp>
+#include <bondrewd/lex/token.hpp>
+#include <bondrewd/ast/ast_nodes.gen.hpp>
+
+#include <tuple>
+#include <array>
+#include <vector>
+#include <span>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <unordered_map>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <stdexcept>
+
+
+namespace bondrewd::ast::flat {
+
+
+#pragma region Forward declarations
+struct file;
+struct stmt;
+struct expr;
+struct defn;
+struct flow;
+struct args_spec;
+struct arg_spec;
+struct call_args;
+struct call_arg;
+struct File;
+struct Assign;
+struct CartridgeHeader;
+struct Expr;
+struct Pass;
+struct VarRef;
+struct Constant;
+struct DotAttribute;
+struct ColonAttribute;
+struct Call;
+struct MacroCall;
+struct InfixCall;
+struct Subscript;
+struct CtimeBlock;
+struct Block;
+struct Defn;
+struct BinOp;
+struct UnOp;
+struct Compare;
+struct BoolOp;
+struct Flow;
+struct Return;
+struct Break;
+struct Continue;
+struct Expand;
+struct Tuple;
+struct Array;
+struct TokenStream;
+struct PassSpec;
+struct VarDef;
+struct ImplDef;
+struct FuncDef;
+struct StructDef;
+struct NsDef;
+struct TemplateDef;
+struct If;
+struct For;
+struct While;
+struct Loop;
+#pragma endregion Forward declarations
+
+
+#pragma region Sum kinds
+// Sums only exist as tags for node_ref; their alternatives are the actual rows
+struct file {
+    static constexpr unsigned kind_bits = 1;
+
+    enum class kind_t : uint8_t {
+        File = 0,
+    };
+};
+
+struct stmt {
+    static constexpr unsigned kind_bits = 2;
+
+    enum class kind_t : uint8_t {
+        Assign = 0,
+        CartridgeHeader = 1,
+        Expr = 2,
+        Pass = 3,
+    };
+};
+
+struct expr {
+    static constexpr unsigned kind_bits = 5;
+
+    enum class kind_t : uint8_t {
+        VarRef = 0,
+        Constant = 1,
+        DotAttribute = 2,
+        ColonAttribute = 3,
+        Call = 4,
+        MacroCall = 5,
+        InfixCall = 6,
+        Subscript = 7,
+        CtimeBlock = 8,
+        Block = 9,
+        Defn = 10,
+        BinOp = 11,
+        UnOp = 12,
+        Compare = 13,
+        BoolOp = 14,
+        Flow = 15,
+        Return = 16,
+        Break = 17,
+        Continue = 18,
+        Expand = 19,
+        Tuple = 20,
+        Array = 21,
+        TokenStream = 22,
+        PassSpec = 23,
+    };
+};
+
+struct defn {
+    static constexpr unsigned kind_bits = 3;
+
+    enum class kind_t : uint8_t {
+        VarDef = 0,
+        ImplDef = 1,
+        FuncDef = 2,
+        StructDef = 3,
+        NsDef = 4,
+        TemplateDef = 5,
+    };
+};
+
+struct flow {
+    static constexpr unsigned kind_bits = 2;
+
+    enum class kind_t : uint8_t {
+        If = 0,
+        For = 1,
+        While = 2,
+        Loop = 3,
+    };
+};
+#pragma endregion Sum kinds
+
+
+#pragma region Rows
+struct File {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "File";
+
+    static constexpr std::array<const char *, 1> field_names{"body"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<node_ref<stmt>> body{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(body);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(body);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Assign {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Assign";
+
+    static constexpr std::array<const char *, 3> field_names{"target", "value", "op"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> target{};
+    node_ref<expr> value{};
+    assign_op op{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(target, value, op);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(target, value, op);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct CartridgeHeader {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "CartridgeHeader";
+
+    static constexpr std::array<const char *, 1> field_names{"name"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Expr {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Expr";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Pass {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Pass";
+
+    static constexpr std::array<const char *, 0> field_names{};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie();
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie();
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct VarRef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "VarRef";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Constant {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Constant";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    constant value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct DotAttribute {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "DotAttribute";
+
+    static constexpr std::array<const char *, 2> field_names{"value", "attr"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    ref<identifier> attr{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value, attr);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value, attr);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct ColonAttribute {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "ColonAttribute";
+
+    static constexpr std::array<const char *, 2> field_names{"value", "attr"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    ref<identifier> attr{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value, attr);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value, attr);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Call {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Call";
+
+    static constexpr std::array<const char *, 2> field_names{"func", "args"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> func{};
+    ref<call_args> args{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(func, args);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(func, args);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct MacroCall {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "MacroCall";
+
+    static constexpr std::array<const char *, 2> field_names{"func", "token_stream"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> func{};
+    node_ref<expr> token_stream{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(func, token_stream);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(func, token_stream);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct InfixCall {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "InfixCall";
+
+    static constexpr std::array<const char *, 3> field_names{"name", "left", "right"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    node_ref<expr> left{};
+    node_ref<expr> right{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name, left, right);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name, left, right);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Subscript {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Subscript";
+
+    static constexpr std::array<const char *, 2> field_names{"value", "args"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    ref<call_args> args{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value, args);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value, args);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct CtimeBlock {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "CtimeBlock";
+
+    static constexpr std::array<const char *, 1> field_names{"body"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> body{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(body);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(body);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Block {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Block";
+
+    static constexpr std::array<const char *, 2> field_names{"body", "value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<node_ref<stmt>> body{};
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(body, value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(body, value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Defn {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Defn";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<defn> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct BinOp {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "BinOp";
+
+    static constexpr std::array<const char *, 3> field_names{"op", "left", "right"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    binary_op op{};
+    node_ref<expr> left{};
+    node_ref<expr> right{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(op, left, right);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(op, left, right);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct UnOp {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "UnOp";
+
+    static constexpr std::array<const char *, 2> field_names{"op", "operand"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    unary_op op{};
+    node_ref<expr> operand{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(op, operand);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(op, operand);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Compare {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Compare";
+
+    static constexpr std::array<const char *, 3> field_names{"left", "op", "operands"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> left{};
+    slice<cmp_op> op{};
+    slice<node_ref<expr>> operands{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(left, op, operands);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(left, op, operands);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct BoolOp {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "BoolOp";
+
+    static constexpr std::array<const char *, 2> field_names{"op", "values"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    bool_op op{};
+    slice<node_ref<expr>> values{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(op, values);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(op, values);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Flow {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Flow";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<flow> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Return {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Return";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Break {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Break";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Continue {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Continue";
+
+    static constexpr std::array<const char *, 0> field_names{};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie();
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie();
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Expand {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Expand";
+
+    static constexpr std::array<const char *, 1> field_names{"value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Tuple {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Tuple";
+
+    static constexpr std::array<const char *, 1> field_names{"values"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<node_ref<expr>> values{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(values);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(values);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Array {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Array";
+
+    static constexpr std::array<const char *, 1> field_names{"values"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<node_ref<expr>> values{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(values);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(values);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct TokenStream {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "TokenStream";
+
+    static constexpr std::array<const char *, 1> field_names{"tokens"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<lex::Token> tokens{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(tokens);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(tokens);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct PassSpec {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "PassSpec";
+
+    static constexpr std::array<const char *, 2> field_names{"kind", "value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    pass_kind kind{};
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(kind, value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(kind, value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct VarDef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "VarDef";
+
+    static constexpr std::array<const char *, 5> field_names{"name", "type", "value", "mut", "flag"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    node_ref<expr> type{};
+    node_ref<expr> value{};
+    bool mut{};
+    xtime_flag flag{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name, type, value, mut, flag);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name, type, value, mut, flag);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct ImplDef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "ImplDef";
+
+    static constexpr std::array<const char *, 4> field_names{"cls", "trait", "body", "flag"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> cls{};
+    node_ref<expr> trait{};
+    slice<node_ref<stmt>> body{};
+    xtime_flag flag{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(cls, trait, body, flag);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(cls, trait, body, flag);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct FuncDef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "FuncDef";
+
+    static constexpr std::array<const char *, 5> field_names{"name", "args", "return_type", "body", "flag"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    ref<args_spec> args{};
+    node_ref<expr> return_type{};
+    node_ref<expr> body{};
+    xtime_flag flag{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name, args, return_type, body, flag);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name, args, return_type, body, flag);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct StructDef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "StructDef";
+
+    static constexpr std::array<const char *, 3> field_names{"name", "fields", "flag"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    ref<args_spec> fields{};
+    xtime_flag flag{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name, fields, flag);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name, fields, flag);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct NsDef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "NsDef";
+
+    static constexpr std::array<const char *, 2> field_names{"names", "flag"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<ref<identifier>> names{};
+    xtime_flag flag{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(names, flag);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(names, flag);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct TemplateDef {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "TemplateDef";
+
+    static constexpr std::array<const char *, 3> field_names{"args", "body", "flag"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<args_spec> args{};
+    node_ref<defn> body{};
+    xtime_flag flag{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(args, body, flag);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(args, body, flag);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct If {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "If";
+
+    static constexpr std::array<const char *, 4> field_names{"cond", "body", "orelse", "unwrap"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> cond{};
+    node_ref<expr> body{};
+    node_ref<expr> orelse{};
+    bool unwrap{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(cond, body, orelse, unwrap);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(cond, body, orelse, unwrap);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct For {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "For";
+
+    static constexpr std::array<const char *, 5> field_names{"var", "iter", "body", "orelse", "unwrap"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> var{};
+    node_ref<expr> iter{};
+    node_ref<expr> body{};
+    node_ref<expr> orelse{};
+    bool unwrap{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(var, iter, body, orelse, unwrap);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(var, iter, body, orelse, unwrap);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct While {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "While";
+
+    static constexpr std::array<const char *, 4> field_names{"cond", "body", "orelse", "unwrap"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> cond{};
+    node_ref<expr> body{};
+    node_ref<expr> orelse{};
+    bool unwrap{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(cond, body, orelse, unwrap);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(cond, body, orelse, unwrap);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct Loop {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "Loop";
+
+    static constexpr std::array<const char *, 2> field_names{"body", "unwrap"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<expr> body{};
+    bool unwrap{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(body, unwrap);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(body, unwrap);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct args_spec {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "args_spec";
+
+    static constexpr std::array<const char *, 2> field_names{"args", "with_self"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<ref<arg_spec>> args{};
+    bool with_self{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(args, with_self);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(args, with_self);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct arg_spec {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "arg_spec";
+
+    static constexpr std::array<const char *, 3> field_names{"name", "type", "default_value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    node_ref<expr> type{};
+    node_ref<expr> default_value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name, type, default_value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name, type, default_value);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct call_args {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "call_args";
+
+    static constexpr std::array<const char *, 3> field_names{"args", "vararg", "kwarg"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    slice<ref<call_arg>> args{};
+    ref<identifier> vararg{};
+    ref<identifier> kwarg{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(args, vararg, kwarg);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(args, vararg, kwarg);
+    }
+    #pragma endregion Uniform fields access
+};
+
+struct call_arg {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "call_arg";
+
+    static constexpr std::array<const char *, 2> field_names{"name", "value"};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    ref<identifier> name{};
+    node_ref<expr> value{};
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(name, value);
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(name, value);
+    }
+    #pragma endregion Uniform fields access
+};
+#pragma endregion Rows
+
+
+#pragma region Visiting
+/**
+ * Dispatches on the kind of a node_ref. Works for any view with the same
+ * get_rows as Tree, e.g. a MappedTree.
+ */
+template <typename View, typename F>
+decltype(auto) visit_node(const View &view, node_ref<file> node, F &&func) {
+    assert(node);
+
+    switch (node.kind()) {
+        case file::kind_t::File:
+            return std::invoke(std::forward<F>(func), view.template get_rows<File>()[node.index()]);
+        default:
+            throw std::logic_error("Invalid file kind");
+    }
+}
+
+template <typename View, typename F>
+decltype(auto) visit_node(const View &view, node_ref<stmt> node, F &&func) {
+    assert(node);
+
+    switch (node.kind()) {
+        case stmt::kind_t::Assign:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Assign>()[node.index()]);
+        case stmt::kind_t::CartridgeHeader:
+            return std::invoke(std::forward<F>(func), view.template get_rows<CartridgeHeader>()[node.index()]);
+        case stmt::kind_t::Expr:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Expr>()[node.index()]);
+        case stmt::kind_t::Pass:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Pass>()[node.index()]);
+        default:
+            throw std::logic_error("Invalid stmt kind");
+    }
+}
+
+template <typename View, typename F>
+decltype(auto) visit_node(const View &view, node_ref<expr> node, F &&func) {
+    assert(node);
+
+    switch (node.kind()) {
+        case expr::kind_t::VarRef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<VarRef>()[node.index()]);
+        case expr::kind_t::Constant:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Constant>()[node.index()]);
+        case expr::kind_t::DotAttribute:
+            return std::invoke(std::forward<F>(func), view.template get_rows<DotAttribute>()[node.index()]);
+        case expr::kind_t::ColonAttribute:
+            return std::invoke(std::forward<F>(func), view.template get_rows<ColonAttribute>()[node.index()]);
+        case expr::kind_t::Call:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Call>()[node.index()]);
+        case expr::kind_t::MacroCall:
+            return std::invoke(std::forward<F>(func), view.template get_rows<MacroCall>()[node.index()]);
+        case expr::kind_t::InfixCall:
+            return std::invoke(std::forward<F>(func), view.template get_rows<InfixCall>()[node.index()]);
+        case expr::kind_t::Subscript:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Subscript>()[node.index()]);
+        case expr::kind_t::CtimeBlock:
+            return std::invoke(std::forward<F>(func), view.template get_rows<CtimeBlock>()[node.index()]);
+        case expr::kind_t::Block:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Block>()[node.index()]);
+        case expr::kind_t::Defn:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Defn>()[node.index()]);
+        case expr::kind_t::BinOp:
+            return std::invoke(std::forward<F>(func), view.template get_rows<BinOp>()[node.index()]);
+        case expr::kind_t::UnOp:
+            return std::invoke(std::forward<F>(func), view.template get_rows<UnOp>()[node.index()]);
+        case expr::kind_t::Compare:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Compare>()[node.index()]);
+        case expr::kind_t::BoolOp:
+            return std::invoke(std::forward<F>(func), view.template get_rows<BoolOp>()[node.index()]);
+        case expr::kind_t::Flow:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Flow>()[node.index()]);
+        case expr::kind_t::Return:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Return>()[node.index()]);
+        case expr::kind_t::Break:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Break>()[node.index()]);
+        case expr::kind_t::Continue:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Continue>()[node.index()]);
+        case expr::kind_t::Expand:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Expand>()[node.index()]);
+        case expr::kind_t::Tuple:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Tuple>()[node.index()]);
+        case expr::kind_t::Array:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Array>()[node.index()]);
+        case expr::kind_t::TokenStream:
+            return std::invoke(std::forward<F>(func), view.template get_rows<TokenStream>()[node.index()]);
+        case expr::kind_t::PassSpec:
+            return std::invoke(std::forward<F>(func), view.template get_rows<PassSpec>()[node.index()]);
+        default:
+            throw std::logic_error("Invalid expr kind");
+    }
+}
+
+template <typename View, typename F>
+decltype(auto) visit_node(const View &view, node_ref<defn> node, F &&func) {
+    assert(node);
+
+    switch (node.kind()) {
+        case defn::kind_t::VarDef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<VarDef>()[node.index()]);
+        case defn::kind_t::ImplDef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<ImplDef>()[node.index()]);
+        case defn::kind_t::FuncDef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<FuncDef>()[node.index()]);
+        case defn::kind_t::StructDef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<StructDef>()[node.index()]);
+        case defn::kind_t::NsDef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<NsDef>()[node.index()]);
+        case defn::kind_t::TemplateDef:
+            return std::invoke(std::forward<F>(func), view.template get_rows<TemplateDef>()[node.index()]);
+        default:
+            throw std::logic_error("Invalid defn kind");
+    }
+}
+
+template <typename View, typename F>
+decltype(auto) visit_node(const View &view, node_ref<flow> node, F &&func) {
+    assert(node);
+
+    switch (node.kind()) {
+        case flow::kind_t::If:
+            return std::invoke(std::forward<F>(func), view.template get_rows<If>()[node.index()]);
+        case flow::kind_t::For:
+            return std::invoke(std::forward<F>(func), view.template get_rows<For>()[node.index()]);
+        case flow::kind_t::While:
+            return std::invoke(std::forward<F>(func), view.template get_rows<While>()[node.index()]);
+        case flow::kind_t::Loop:
+            return std::invoke(std::forward<F>(func), view.template get_rows<Loop>()[node.index()]);
+        default:
+            throw std::logic_error("Invalid flow kind");
+    }
+}
+#pragma endregion Visiting
+
+
+#pragma region TreeDumper
+/**
+ * Prints a tree in a human-readable form.
+ *
+ * Only needs read access through get_rows and operator[], so it works both
+ * for a Tree and for a MappedTree, without loading the latter.
+ */
+template <typename View>
+class TreeDumper {
+public:
+    #pragma region Constructors
+    TreeDumper(const View &view, std::ostream &stream) :
+        view{&view}, stream{&stream} {}
+    #pragma endregion Constructors
+
+    #pragma region API
+    template <typename Root>
+    std::ostream &dump(const Root &root) {
+        if (root) {
+            dump_value(root);
+        } else {
+            *stream << "<empty>";
+        }
+
+        return *stream << "\n";
+    }
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    const View *view;
+    std::ostream *stream;
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    template <typename T>
+    void dump_value(const T &value) {
+        if constexpr (is_node_ref<T>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            visit_node(*view, value, [&](const auto &row) { dump_row(row); });
+        } else if constexpr (std::same_as<T, ref<identifier>>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            *stream << (*view)[value];
+        } else if constexpr (is_ref<T>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            dump_row((*view)[value]);
+        } else if constexpr (std::same_as<T, slice<char>>) {
+            auto chars = (*view)[value];
+
+            *stream << std::quoted(std::string_view{chars.data(), chars.size()});
+        } else if constexpr (is_slice<T>) {
+            *stream << "[";
+
+            bool first = true;
+            for (const auto &item : (*view)[value]) {
+                if (!first) {
+                    *stream << ", ";
+                }
+                first = false;
+
+                dump_value(item);
+            }
+
+            *stream << "]";
+        } else if constexpr (util::specialization_of<T, std::optional>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            dump_value(*value);
+        } else if constexpr (std::same_as<T, constant>) {
+            std::visit([&](const auto &item) { dump_value(item); }, value);
+        } else if constexpr (std::same_as<T, std::monostate>) {
+            *stream << "()";
+        } else if constexpr (std::same_as<T, bool>) {
+            *stream << (value ? "true" : "false");
+        } else if constexpr (std::is_enum_v<T>) {
+            *stream << to_string(value);
+        } else if constexpr (requires { value.dump(*stream); }) {
+            value.dump(*stream);
+        } else {
+            *stream << value;
+        }
+    }
+
+    template <typename Row>
+    void dump_row(const Row &row) {
+        *stream << Row::node_name << "(";
+
+        size_t idx = 0;
+        std::apply([&](const auto &... fields) {
+            ((*stream << (idx ? ", " : "") << Row::field_names[idx] << "=",
+              dump_value(fields), ++idx), ...);
+        }, row.get_fields_tuple());
+
+        *stream << ")";
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion TreeDumper
+
+
+#pragma region Tree
+/**
+ * A whole AST, stored as a struct of arrays.
+ *
+ * Every row type has its own contiguous array, and children are referenced
+ * by 32-bit indices into them (see ref and node_ref). Sequences and strings
+ * are slices of shared per-element-type pools. Identifiers are indices into
+ * the tree's own identifier table, so apart from it (and raw tokens), the
+ * whole tree is plain data that can be copied around in bulk.
+ *
+ * Rows are appended in post-order, i.e. children always precede their parents.
+ */
+class Tree {
+public:
+    #pragma region Constants and typedefs
+    using rows_t = std::tuple<
+        std::vector<File>,
+        std::vector<Assign>,
+        std::vector<CartridgeHeader>,
+        std::vector<Expr>,
+        std::vector<Pass>,
+        std::vector<VarRef>,
+        std::vector<Constant>,
+        std::vector<DotAttribute>,
+        std::vector<ColonAttribute>,
+        std::vector<Call>,
+        std::vector<MacroCall>,
+        std::vector<InfixCall>,
+        std::vector<Subscript>,
+        std::vector<CtimeBlock>,
+        std::vector<Block>,
+        std::vector<Defn>,
+        std::vector<BinOp>,
+        std::vector<UnOp>,
+        std::vector<Compare>,
+        std::vector<BoolOp>,
+        std::vector<Flow>,
+        std::vector<Return>,
+        std::vector<Break>,
+        std::vector<Continue>,
+        std::vector<Expand>,
+        std::vector<Tuple>,
+        std::vector<Array>,
+        std::vector<TokenStream>,
+        std::vector<PassSpec>,
+        std::vector<VarDef>,
+        std::vector<ImplDef>,
+        std::vector<FuncDef>,
+        std::vector<StructDef>,
+        std::vector<NsDef>,
+        std::vector<TemplateDef>,
+        std::vector<If>,
+        std::vector<For>,
+        std::vector<While>,
+        std::vector<Loop>,
+        std::vector<args_spec>,
+        std::vector<arg_spec>,
+        std::vector<call_args>,
+        std::vector<call_arg>
+    >;
+
+    using pools_t = std::tuple<
+        std::vector<node_ref<stmt>>,
+        std::vector<cmp_op>,
+        std::vector<node_ref<expr>>,
+        std::vector<lex::Token>,
+        std::vector<ref<identifier>>,
+        std::vector<ref<arg_spec>>,
+        std::vector<ref<call_arg>>,
+        std::vector<char>
+    >;
+
+    /// Changes whenever the ASDL definition does
+    static constexpr uint64_t schema_hash = 0xb9ba12a22297a511;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    node_ref<file> root{};
+    #pragma endregion Fields
+
+    #pragma region Constructors
+    Tree() = default;
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    Tree(const Tree &) = default;
+    Tree(Tree &&) = default;
+    Tree &operator=(const Tree &) = default;
+    Tree &operator=(Tree &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Storage access
+    template <typename T>
+    std::vector<T> &get_rows() {
+        return std::get<std::vector<T>>(rows);
+    }
+
+    template <typename T>
+    const std::vector<T> &get_rows() const {
+        return std::get<std::vector<T>>(rows);
+    }
+
+    template <typename T>
+    std::vector<T> &get_pool() {
+        return std::get<std::vector<T>>(pools);
+    }
+
+    template <typename T>
+    const std::vector<T> &get_pool() const {
+        return std::get<std::vector<T>>(pools);
+    }
+
+    rows_t &get_all_rows() {
+        return rows;
+    }
+
+    const rows_t &get_all_rows() const {
+        return rows;
+    }
+
+    pools_t &get_all_pools() {
+        return pools;
+    }
+
+    const pools_t &get_all_pools() const {
+        return pools;
+    }
+
+    std::vector<identifier> &get_identifiers() {
+        return identifiers;
+    }
+
+    const std::vector<identifier> &get_identifiers() const {
+        return identifiers;
+    }
+    #pragma endregion Storage access
+
+    #pragma region Dereferencing
+    template <typename T>
+    const T &operator[](ref<T> node) const {
+        assert(node);
+
+        return get_rows<T>()[node.index];
+    }
+
+    const identifier &operator[](ref<identifier> name) const {
+        assert(name);
+
+        return identifiers[name.index];
+    }
+
+    template <typename T>
+    std::span<const T> operator[](slice<T> items) const {
+        return std::span<const T>{get_pool<T>()}.subspan(items.offset, items.size);
+    }
+
+    std::string_view get_string(slice<char> chars) const {
+        auto span = (*this)[chars];
+
+        return std::string_view{span.data(), span.size()};
+    }
+    #pragma endregion Dereferencing
+
+    #pragma region Visiting
+    template <typename F>
+    decltype(auto) visit(node_ref<file> node, F &&func) const {
+        return visit_node(*this, node, std::forward<F>(func));
+    }
+
+    template <typename F>
+    decltype(auto) visit(node_ref<stmt> node, F &&func) const {
+        return visit_node(*this, node, std::forward<F>(func));
+    }
+
+    template <typename F>
+    decltype(auto) visit(node_ref<expr> node, F &&func) const {
+        return visit_node(*this, node, std::forward<F>(func));
+    }
+
+    template <typename F>
+    decltype(auto) visit(node_ref<defn> node, F &&func) const {
+        return visit_node(*this, node, std::forward<F>(func));
+    }
+
+    template <typename F>
+    decltype(auto) visit(node_ref<flow> node, F &&func) const {
+        return visit_node(*this, node, std::forward<F>(func));
+    }
+    #pragma endregion Visiting
+
+    #pragma region API
+    size_t get_node_count() const {
+        return std::apply([](const auto &... arrays) {
+            return (arrays.size() + ... + 0);
+        }, rows);
+    }
+
+    /// Approximate, counts only the used part of the arrays
+    size_t get_memory_usage() const {
+        auto array_size = [](const auto &array) {
+            return array.size() * sizeof(typename std::decay_t<decltype(array)>::value_type);
+        };
+
+        size_t result = identifiers.size() * sizeof(identifier);
+
+        std::apply([&](const auto &... arrays) { result += (array_size(arrays) + ... + 0); }, rows);
+        std::apply([&](const auto &... arrays) { result += (array_size(arrays) + ... + 0); }, pools);
+
+        return result;
+    }
+
+    void clear() {
+        root = {};
+        std::apply([](auto &... arrays) { (arrays.clear(), ...); }, rows);
+        std::apply([](auto &... arrays) { (arrays.clear(), ...); }, pools);
+        identifiers.clear();
+    }
+    #pragma endregion API
+
+    #pragma region Debug
+    std::ostream &dump(std::ostream &stream = std::cout) const {
+        return TreeDumper<Tree>{*this, stream}.dump(root);
+    }
+    #pragma endregion Debug
+
+protected:
+    #pragma region Fields
+    rows_t rows{};
+    pools_t pools{};
+    std::vector<identifier> identifiers{};
+    #pragma endregion Fields
+
+};
+#pragma endregion Tree
+
+
+#pragma region Flattener
+/**
+ * Converts the pointer-based AST (ast::nodes) into a flat Tree.
+ */
+class Flattener {
+public:
+    #pragma region Constructors
+    explicit Flattener(Tree &tree) :
+        tree{&tree} {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    Flattener(const Flattener &) = delete;
+    Flattener(Flattener &&) = default;
+    Flattener &operator=(const Flattener &) = delete;
+    Flattener &operator=(Flattener &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Pointers
+    // Note: these have to precede the nodes, since their return types are deduced
+    template <is_ast_ptr T>
+    auto convert(const T &value) {
+        if constexpr (is_sequence<T>) {
+            using item_t = decltype(convert(std::declval<const typename T::element_type::value_type &>()));
+
+            if (!value) {
+                return slice<item_t>{};
+            }
+
+            std::vector<item_t> items{};
+            items.reserve(value->size());
+
+            // Children have to be converted first, since they may append to the same pool
+            for (const auto &item : *value) {
+                items.push_back(convert(item));
+            }
+
+            return push_slice(tree->get_pool<item_t>(), std::span<const item_t>{items});
+        } else {
+            using result_t = decltype(convert(*value));
+
+            if (!value) {
+                return result_t{};
+            }
+
+            return convert(*value);
+        }
+    }
+
+    template <typename T>
+    auto convert(const std::optional<T> &value) {
+        using result_t = decltype(convert(std::declval<const T &>()));
+
+        if constexpr (nullable<result_t>) {
+            return value ? convert(*value) : result_t{};
+        } else {
+            return value ? std::optional<result_t>{convert(*value)} : std::nullopt;
+        }
+    }
+    #pragma endregion Pointers
+
+    #pragma region Basic types
+    ref<identifier> convert(const identifier &name) {
+        auto [it, inserted] = identifier_indices.try_emplace(name, (index_t)tree->get_identifiers().size());
+
+        if (inserted) {
+            tree->get_identifiers().push_back(name);
+        }
+
+        return ref<identifier>{it->second};
+    }
+
+    slice<char> convert(const std::string &text) {
+        return push_slice(tree->get_pool<char>(), std::span<const char>{text.data(), text.size()});
+    }
+
+    constant convert(const ast::constant &value) {
+        return std::visit([&](const auto &item) -> constant {
+            if constexpr (std::same_as<std::decay_t<decltype(item)>, std::string>) {
+                return convert(item);
+            } else {
+                return item;
+            }
+        }, value);
+    }
+
+    lex::Token convert(const lex::Token &token) {
+        return token;
+    }
+
+    template <typename T>
+    requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    T convert(T value) {
+        return value;
+    }
+    #pragma endregion Basic types
+
+    #pragma region Nodes
+    node_ref<file> convert(const nodes::file &node) {
+        switch (node.value.index()) {
+            case 0: {
+                [[maybe_unused]] const auto &alt = std::get<0>(node.value);
+                return add<file>(
+                    file::kind_t::File,
+                    File{convert(alt.body)}
+                );
+            }
+            default:
+                throw std::logic_error("Empty file node");
+        }
+    }
+
+    node_ref<stmt> convert(const nodes::stmt &node) {
+        switch (node.value.index()) {
+            case 0: {
+                [[maybe_unused]] const auto &alt = std::get<0>(node.value);
+                return add<stmt>(
+                    stmt::kind_t::Assign,
+                    Assign{convert(alt.target), convert(alt.value), convert(alt.op)}
+                );
+            }
+            case 1: {
+                [[maybe_unused]] const auto &alt = std::get<1>(node.value);
+                return add<stmt>(
+                    stmt::kind_t::CartridgeHeader,
+                    CartridgeHeader{convert(alt.name)}
+                );
+            }
+            case 2: {
+                [[maybe_unused]] const auto &alt = std::get<2>(node.value);
+                return add<stmt>(
+                    stmt::kind_t::Expr,
+                    Expr{convert(alt.value)}
+                );
+            }
+            case 3: {
+                [[maybe_unused]] const auto &alt = std::get<3>(node.value);
+                return add<stmt>(
+                    stmt::kind_t::Pass,
+                    Pass{}
+                );
+            }
+            default:
+                throw std::logic_error("Empty stmt node");
+        }
+    }
+
+    node_ref<expr> convert(const nodes::expr &node) {
+        switch (node.value.index()) {
+            case 0: {
+                [[maybe_unused]] const auto &alt = std::get<0>(node.value);
+                return add<expr>(
+                    expr::kind_t::VarRef,
+                    VarRef{convert(alt.value)}
+                );
+            }
+            case 1: {
+                [[maybe_unused]] const auto &alt = std::get<1>(node.value);
+                return add<expr>(
+                    expr::kind_t::Constant,
+                    Constant{convert(alt.value)}
+                );
+            }
+            case 2: {
+                [[maybe_unused]] const auto &alt = std::get<2>(node.value);
+                return add<expr>(
+                    expr::kind_t::DotAttribute,
+                    DotAttribute{convert(alt.value), convert(alt.attr)}
+                );
+            }
+            case 3: {
+                [[maybe_unused]] const auto &alt = std::get<3>(node.value);
+                return add<expr>(
+                    expr::kind_t::ColonAttribute,
+                    ColonAttribute{convert(alt.value), convert(alt.attr)}
+                );
+            }
+            case 4: {
+                [[maybe_unused]] const auto &alt = std::get<4>(node.value);
+                return add<expr>(
+                    expr::kind_t::Call,
+                    Call{convert(alt.func), convert(alt.args)}
+                );
+            }
+            case 5: {
+                [[maybe_unused]] const auto &alt = std::get<5>(node.value);
+                return add<expr>(
+                    expr::kind_t::MacroCall,
+                    MacroCall{convert(alt.func), convert(alt.token_stream)}
+                );
+            }
+            case 6: {
+                [[maybe_unused]] const auto &alt = std::get<6>(node.value);
+                return add<expr>(
+                    expr::kind_t::InfixCall,
+                    InfixCall{convert(alt.name), convert(alt.left), convert(alt.right)}
+                );
+            }
+            case 7: {
+                [[maybe_unused]] const auto &alt = std::get<7>(node.value);
+                return add<expr>(
+                    expr::kind_t::Subscript,
+                    Subscript{convert(alt.value), convert(alt.args)}
+                );
+            }
+            case 8: {
+                [[maybe_unused]] const auto &alt = std::get<8>(node.value);
+                return add<expr>(
+                    expr::kind_t::CtimeBlock,
+                    CtimeBlock{convert(alt.body)}
+                );
+            }
+            case 9: {
+                [[maybe_unused]] const auto &alt = std::get<9>(node.value);
+                return add<expr>(
+                    expr::kind_t::Block,
+                    Block{convert(alt.body), convert(alt.value)}
+                );
+            }
+            case 10: {
+                [[maybe_unused]] const auto &alt = std::get<10>(node.value);
+                return add<expr>(
+                    expr::kind_t::Defn,
+                    Defn{convert(alt.value)}
+                );
+            }
+            case 11: {
+                [[maybe_unused]] const auto &alt = std::get<11>(node.value);
+                return add<expr>(
+                    expr::kind_t::BinOp,
+                    BinOp{convert(alt.op), convert(alt.left), convert(alt.right)}
+                );
+            }
+            case 12: {
+                [[maybe_unused]] const auto &alt = std::get<12>(node.value);
+                return add<expr>(
+                    expr::kind_t::UnOp,
+                    UnOp{convert(alt.op), convert(alt.operand)}
+                );
+            }
+            case 13: {
+                [[maybe_unused]] const auto &alt = std::get<13>(node.value);
+                return add<expr>(
+                    expr::kind_t::Compare,
+                    Compare{convert(alt.left), convert(alt.op), convert(alt.operands)}
+                );
+            }
+            case 14: {
+                [[maybe_unused]] const auto &alt = std::get<14>(node.value);
+                return add<expr>(
+                    expr::kind_t::BoolOp,
+                    BoolOp{convert(alt.op), convert(alt.values)}
+                );
+            }
+            case 15: {
+                [[maybe_unused]] const auto &alt = std::get<15>(node.value);
+                return add<expr>(
+                    expr::kind_t::Flow,
+                    Flow{convert(alt.value)}
+                );
+            }
+            case 16: {
+                [[maybe_unused]] const auto &alt = std::get<16>(node.value);
+                return add<expr>(
+                    expr::kind_t::Return,
+                    Return{convert(alt.value)}
+                );
+            }
+            case 17: {
+                [[maybe_unused]] const auto &alt = std::get<17>(node.value);
+                return add<expr>(
+                    expr::kind_t::Break,
+                    Break{convert(alt.value)}
+                );
+            }
+            case 18: {
+                [[maybe_unused]] const auto &alt = std::get<18>(node.value);
+                return add<expr>(
+                    expr::kind_t::Continue,
+                    Continue{}
+                );
+            }
+            case 19: {
+                [[maybe_unused]] const auto &alt = std::get<19>(node.value);
+                return add<expr>(
+                    expr::kind_t::Expand,
+                    Expand{convert(alt.value)}
+                );
+            }
+            case 20: {
+                [[maybe_unused]] const auto &alt = std::get<20>(node.value);
+                return add<expr>(
+                    expr::kind_t::Tuple,
+                    Tuple{convert(alt.values)}
+                );
+            }
+            case 21: {
+                [[maybe_unused]] const auto &alt = std::get<21>(node.value);
+                return add<expr>(
+                    expr::kind_t::Array,
+                    Array{convert(alt.values)}
+                );
+            }
+            case 22: {
+                [[maybe_unused]] const auto &alt = std::get<22>(node.value);
+                return add<expr>(
+                    expr::kind_t::TokenStream,
+                    TokenStream{convert(alt.tokens)}
+                );
+            }
+            case 23: {
+                [[maybe_unused]] const auto &alt = std::get<23>(node.value);
+                return add<expr>(
+                    expr::kind_t::PassSpec,
+                    PassSpec{convert(alt.kind), convert(alt.value)}
+                );
+            }
+            default:
+                throw std::logic_error("Empty expr node");
+        }
+    }
+
+    node_ref<defn> convert(const nodes::defn &node) {
+        switch (node.value.index()) {
+            case 0: {
+                [[maybe_unused]] const auto &alt = std::get<0>(node.value);
+                return add<defn>(
+                    defn::kind_t::VarDef,
+                    VarDef{convert(alt.name), convert(alt.type), convert(alt.value), convert(alt.mut), convert(node.flag)}
+                );
+            }
+            case 1: {
+                [[maybe_unused]] const auto &alt = std::get<1>(node.value);
+                return add<defn>(
+                    defn::kind_t::ImplDef,
+                    ImplDef{convert(alt.cls), convert(alt.trait), convert(alt.body), convert(node.flag)}
+                );
+            }
+            case 2: {
+                [[maybe_unused]] const auto &alt = std::get<2>(node.value);
+                return add<defn>(
+                    defn::kind_t::FuncDef,
+                    FuncDef{convert(alt.name), convert(alt.args), convert(alt.return_type), convert(alt.body), convert(node.flag)}
+                );
+            }
+            case 3: {
+                [[maybe_unused]] const auto &alt = std::get<3>(node.value);
+                return add<defn>(
+                    defn::kind_t::StructDef,
+                    StructDef{convert(alt.name), convert(alt.fields), convert(node.flag)}
+                );
+            }
+            case 4: {
+                [[maybe_unused]] const auto &alt = std::get<4>(node.value);
+                return add<defn>(
+                    defn::kind_t::NsDef,
+                    NsDef{convert(alt.names), convert(node.flag)}
+                );
+            }
+            case 5: {
+                [[maybe_unused]] const auto &alt = std::get<5>(node.value);
+                return add<defn>(
+                    defn::kind_t::TemplateDef,
+                    TemplateDef{convert(alt.args), convert(alt.body), convert(node.flag)}
+                );
+            }
+            default:
+                throw std::logic_error("Empty defn node");
+        }
+    }
+
+    node_ref<flow> convert(const nodes::flow &node) {
+        switch (node.value.index()) {
+            case 0: {
+                [[maybe_unused]] const auto &alt = std::get<0>(node.value);
+                return add<flow>(
+                    flow::kind_t::If,
+                    If{convert(alt.cond), convert(alt.body), convert(alt.orelse), convert(node.unwrap)}
+                );
+            }
+            case 1: {
+                [[maybe_unused]] const auto &alt = std::get<1>(node.value);
+                return add<flow>(
+                    flow::kind_t::For,
+                    For{convert(alt.var), convert(alt.iter), convert(alt.body), convert(alt.orelse), convert(node.unwrap)}
+                );
+            }
+            case 2: {
+                [[maybe_unused]] const auto &alt = std::get<2>(node.value);
+                return add<flow>(
+                    flow::kind_t::While,
+                    While{convert(alt.cond), convert(alt.body), convert(alt.orelse), convert(node.unwrap)}
+                );
+            }
+            case 3: {
+                [[maybe_unused]] const auto &alt = std::get<3>(node.value);
+                return add<flow>(
+                    flow::kind_t::Loop,
+                    Loop{convert(alt.body), convert(node.unwrap)}
+                );
+            }
+            default:
+                throw std::logic_error("Empty flow node");
+        }
+    }
+
+    ref<args_spec> convert(const nodes::args_spec &node) {
+        return add(args_spec{convert(node.args), convert(node.with_self)});
+    }
+
+    ref<arg_spec> convert(const nodes::arg_spec &node) {
+        return add(arg_spec{convert(node.name), convert(node.type), convert(node.default_value)});
+    }
+
+    ref<call_args> convert(const nodes::call_args &node) {
+        return add(call_args{convert(node.args), convert(node.vararg), convert(node.kwarg)});
+    }
+
+    ref<call_arg> convert(const nodes::call_arg &node) {
+        return add(call_arg{convert(node.name), convert(node.value)});
+    }
+    #pragma endregion Nodes
+
+protected:
+    #pragma region Fields
+    Tree *tree;
+    std::unordered_map<identifier, index_t> identifier_indices{};
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    template <typename Sum, typename Row>
+    node_ref<Sum> add(typename Sum::kind_t kind, Row row) {
+        return node_ref<Sum>::make(kind, push_row(tree->get_rows<Row>(), std::move(row)));
+    }
+
+    template <typename Row>
+    ref<Row> add(Row row) {
+        return ref<Row>{push_row(tree->get_rows<Row>(), std::move(row))};
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion Flattener
+
+
+#pragma region flatten
+inline Tree flatten(const nodes::file &root) {
+    Tree tree{};
+
+    tree.root = Flattener{tree}.convert(root);
+
+    return tree;
+}
+
+inline Tree flatten(const field<nodes::file> &root) {
+    if (!root) {
+        return Tree{};
+    }
+
+    return flatten(*root);
+}
+#pragma endregion flatten
+
+
+}  // namespace bondrewd::ast::flat
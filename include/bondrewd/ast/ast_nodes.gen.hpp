@@ -1,4 +1,4 @@
-// AUTOGENERATED by bondrewd/tools/asdl++/asdl_cpp.py on 2023-04-24 21:29:23
+// AUTOGENERATED by bondrewd/tools/asdl++/asdl_cpp.py on 2026-10-17 07:40:15
 // DO NOT EDIT
 
 #pragma once
@@ -55,69 +55,191 @@ class If;
 class For;
 class While;
 class Loop;
-class assign_op;
-class AsgnNone;
-class AsgnAdd;
-class AsgnSub;
-class AsgnMul;
-class AsgnDiv;
-class AsgnMod;
-class AsgnLShift;
-class AsgnRShift;
-class AsgnBitOr;
-class AsgnBitXor;
-class AsgnBitAnd;
-class bool_op;
-class And;
-class Or;
-class binary_op;
-class Add;
-class Sub;
-class Mul;
-class Div;
-class Mod;
-class Pow;
-class LShift;
-class RShift;
-class BitOr;
-class BitXor;
-class BitAnd;
-class BidirCmp;
-class unary_op;
-class BitInv;
-class Not;
-class UAdd;
-class USub;
-class URef;
-class UStar;
-class cmp_op;
-class Eq;
-class NotEq;
-class Lt;
-class LtE;
-class Gt;
-class GtE;
-class In;
-class NotIn;
-class expr_context;
-class Load;
-class Store;
 class args_spec;
 class arg_spec;
 class call_args;
 class call_arg;
-class xtime_flag;
-class CTime;
-class RTime;
-class DefaultTime;
-class pass_kind;
-class ByRef;
-class ByMove;
-class ByCopy;
 class token;
 #pragma endregion Forward declarations
 
 
+#pragma region Enumerations
+// Enum-like sums are defined upfront, since other nodes store them by value
+enum class assign_op : uint8_t {
+    AsgnNone = 0,
+    AsgnAdd = 1,
+    AsgnSub = 2,
+    AsgnMul = 3,
+    AsgnDiv = 4,
+    AsgnMod = 5,
+    AsgnLShift = 6,
+    AsgnRShift = 7,
+    AsgnBitOr = 8,
+    AsgnBitXor = 9,
+    AsgnBitAnd = 10,
+};
+
+constexpr const char *to_string(assign_op value) noexcept {
+    switch (value) {
+        case assign_op::AsgnNone: return "AsgnNone";
+        case assign_op::AsgnAdd: return "AsgnAdd";
+        case assign_op::AsgnSub: return "AsgnSub";
+        case assign_op::AsgnMul: return "AsgnMul";
+        case assign_op::AsgnDiv: return "AsgnDiv";
+        case assign_op::AsgnMod: return "AsgnMod";
+        case assign_op::AsgnLShift: return "AsgnLShift";
+        case assign_op::AsgnRShift: return "AsgnRShift";
+        case assign_op::AsgnBitOr: return "AsgnBitOr";
+        case assign_op::AsgnBitXor: return "AsgnBitXor";
+        case assign_op::AsgnBitAnd: return "AsgnBitAnd";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class bool_op : uint8_t {
+    And = 0,
+    Or = 1,
+};
+
+constexpr const char *to_string(bool_op value) noexcept {
+    switch (value) {
+        case bool_op::And: return "And";
+        case bool_op::Or: return "Or";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class binary_op : uint8_t {
+    Add = 0,
+    Sub = 1,
+    Mul = 2,
+    Div = 3,
+    Mod = 4,
+    Pow = 5,
+    LShift = 6,
+    RShift = 7,
+    BitOr = 8,
+    BitXor = 9,
+    BitAnd = 10,
+    BidirCmp = 11,
+};
+
+constexpr const char *to_string(binary_op value) noexcept {
+    switch (value) {
+        case binary_op::Add: return "Add";
+        case binary_op::Sub: return "Sub";
+        case binary_op::Mul: return "Mul";
+        case binary_op::Div: return "Div";
+        case binary_op::Mod: return "Mod";
+        case binary_op::Pow: return "Pow";
+        case binary_op::LShift: return "LShift";
+        case binary_op::RShift: return "RShift";
+        case binary_op::BitOr: return "BitOr";
+        case binary_op::BitXor: return "BitXor";
+        case binary_op::BitAnd: return "BitAnd";
+        case binary_op::BidirCmp: return "BidirCmp";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class unary_op : uint8_t {
+    BitInv = 0,
+    Not = 1,
+    UAdd = 2,
+    USub = 3,
+    URef = 4,
+    UStar = 5,
+};
+
+constexpr const char *to_string(unary_op value) noexcept {
+    switch (value) {
+        case unary_op::BitInv: return "BitInv";
+        case unary_op::Not: return "Not";
+        case unary_op::UAdd: return "UAdd";
+        case unary_op::USub: return "USub";
+        case unary_op::URef: return "URef";
+        case unary_op::UStar: return "UStar";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class cmp_op : uint8_t {
+    Eq = 0,
+    NotEq = 1,
+    Lt = 2,
+    LtE = 3,
+    Gt = 4,
+    GtE = 5,
+    In = 6,
+    NotIn = 7,
+};
+
+constexpr const char *to_string(cmp_op value) noexcept {
+    switch (value) {
+        case cmp_op::Eq: return "Eq";
+        case cmp_op::NotEq: return "NotEq";
+        case cmp_op::Lt: return "Lt";
+        case cmp_op::LtE: return "LtE";
+        case cmp_op::Gt: return "Gt";
+        case cmp_op::GtE: return "GtE";
+        case cmp_op::In: return "In";
+        case cmp_op::NotIn: return "NotIn";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class expr_context : uint8_t {
+    Load = 0,
+    Store = 1,
+};
+
+constexpr const char *to_string(expr_context value) noexcept {
+    switch (value) {
+        case expr_context::Load: return "Load";
+        case expr_context::Store: return "Store";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class xtime_flag : uint8_t {
+    CTime = 0,
+    RTime = 1,
+    DefaultTime = 2,
+};
+
+constexpr const char *to_string(xtime_flag value) noexcept {
+    switch (value) {
+        case xtime_flag::CTime: return "CTime";
+        case xtime_flag::RTime: return "RTime";
+        case xtime_flag::DefaultTime: return "DefaultTime";
+        default: return "<unknown>";
+    }
+}
+
+
+enum class pass_kind : uint8_t {
+    ByRef = 0,
+    ByMove = 1,
+    ByCopy = 2,
+};
+
+constexpr const char *to_string(pass_kind value) noexcept {
+    switch (value) {
+        case pass_kind::ByRef: return "ByRef";
+        case pass_kind::ByMove: return "ByMove";
+        case pass_kind::ByCopy: return "ByCopy";
+        default: return "<unknown>";
+    }
+}
+#pragma endregion Enumerations
+
+
 #pragma region Implementations
 class File : public _ConcreteASTNode {
 public:
@@ -208,11 +330,11 @@ public:
     #pragma region Fields
     field<expr> target;
     field<expr> value;
-    field<assign_op> op;
+    assign_op op;
     #pragma endregion Fields
 
     #pragma region Constructors
-    Assign(field<expr> target, field<expr> value, field<assign_op> op) :
+    Assign(field<expr> target, field<expr> value, assign_op op) :
         target{std::move(target)}, value{std::move(value)}, op{std::move(op)} {}
     #pragma endregion Constructors
     
@@ -984,13 +1106,13 @@ public:
 class BinOp : public _ConcreteASTNode {
 public:
     #pragma region Fields
-    field<binary_op> op;
+    binary_op op;
     field<expr> left;
     field<expr> right;
     #pragma endregion Fields
 
     #pragma region Constructors
-    BinOp(field<binary_op> op, field<expr> left, field<expr> right) :
+    BinOp(binary_op op, field<expr> left, field<expr> right) :
         op{std::move(op)}, left{std::move(left)}, right{std::move(right)} {}
     #pragma endregion Constructors
     
@@ -1035,12 +1157,12 @@ public:
 class UnOp : public _ConcreteASTNode {
 public:
     #pragma region Fields
-    field<unary_op> op;
+    unary_op op;
     field<expr> operand;
     #pragma endregion Fields
 
     #pragma region Constructors
-    UnOp(field<unary_op> op, field<expr> operand) :
+    UnOp(unary_op op, field<expr> operand) :
         op{std::move(op)}, operand{std::move(operand)} {}
     #pragma endregion Constructors
     
@@ -1136,12 +1258,12 @@ public:
 class BoolOp : public _ConcreteASTNode {
 public:
     #pragma region Fields
-    field<bool_op> op;
+    bool_op op;
     sequence<expr> values;
     #pragma endregion Fields
 
     #pragma region Constructors
-    BoolOp(field<bool_op> op, sequence<expr> values) :
+    BoolOp(bool_op op, sequence<expr> values) :
         op{std::move(op)}, values{std::move(values)} {}
     #pragma endregion Constructors
     
@@ -1576,12 +1698,12 @@ public:
 class PassSpec : public _ConcreteASTNode {
 public:
     #pragma region Fields
-    field<pass_kind> kind;
+    pass_kind kind;
     field<expr> value;
     #pragma endregion Fields
 
     #pragma region Constructors
-    PassSpec(field<pass_kind> kind, field<expr> value) :
+    PassSpec(pass_kind kind, field<expr> value) :
         kind{std::move(kind)}, value{std::move(value)} {}
     #pragma endregion Constructors
     
@@ -1965,7 +2087,7 @@ public:
 class defn : public _AST<VarDef, ImplDef, FuncDef, StructDef, NsDef, TemplateDef> {
 public:
     #pragma region Constructors
-    defn(auto &&value_, field<xtime_flag> flag)
+    defn(auto &&value_, xtime_flag flag)
         : _AST(std::forward<decltype(value_)>(value_)), std::move(flag) {}
     #pragma endregion Constructors
     
@@ -1982,7 +2104,7 @@ public:
 
     #pragma region Attributes
     
-    field<xtime_flag> flag;
+    xtime_flag flag;
     #pragma endregion Attributes
 
     #pragma region Casts
@@ -1995,7 +2117,7 @@ public:
     #pragma region Extras
     
     defn(auto &&value) :
-        defn(std::forward<decltype(value)>(value), DefaultTime()) {}
+        defn(std::forward<decltype(value)>(value), xtime_flag::DefaultTime) {}
 
     #pragma endregion Extras
 };
@@ -2243,208 +2365,23 @@ public:
 };
 
 
-class AsgnNone : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnNone() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnNone(const AsgnNone &) = delete;
-    AsgnNone(AsgnNone &&) = default;
-    AsgnNone &operator=(const AsgnNone &) = delete;
-    AsgnNone &operator=(AsgnNone &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnAdd : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnAdd() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnAdd(const AsgnAdd &) = delete;
-    AsgnAdd(AsgnAdd &&) = default;
-    AsgnAdd &operator=(const AsgnAdd &) = delete;
-    AsgnAdd &operator=(AsgnAdd &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnSub : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnSub() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnSub(const AsgnSub &) = delete;
-    AsgnSub(AsgnSub &&) = default;
-    AsgnSub &operator=(const AsgnSub &) = delete;
-    AsgnSub &operator=(AsgnSub &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnMul : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnMul() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnMul(const AsgnMul &) = delete;
-    AsgnMul(AsgnMul &&) = default;
-    AsgnMul &operator=(const AsgnMul &) = delete;
-    AsgnMul &operator=(AsgnMul &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnDiv : public _ConcreteASTNode {
+class args_spec {
 public:
     #pragma region Fields
+    sequence<arg_spec> args;
+    bool with_self;
     #pragma endregion Fields
 
     #pragma region Constructors
-    AsgnDiv() {};
+    args_spec(sequence<arg_spec> args, bool with_self) :
+        args{std::move(args)}, with_self{std::move(with_self)} {}
     #pragma endregion Constructors
     
     #pragma region Service constructors
-    AsgnDiv(const AsgnDiv &) = delete;
-    AsgnDiv(AsgnDiv &&) = default;
-    AsgnDiv &operator=(const AsgnDiv &) = delete;
-    AsgnDiv &operator=(AsgnDiv &&) = default;
+    args_spec(const args_spec &) = delete;
+    args_spec(args_spec &&) = default;
+    args_spec &operator=(const args_spec &) = delete;
+    args_spec &operator=(args_spec &&) = default;
     #pragma endregion Service constructors
 
     #pragma region Uniform fields access
@@ -2453,7 +2390,7 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() {
-        return std::tie();
+        return std::tie(args, with_self);
     }
 
     /**
@@ -2461,14 +2398,14 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() const {
-        return std::tie();
+        return std::tie(args, with_self);
     }
     #pragma endregion Uniform fields access
 
     #pragma region Casts
     // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
+    operator ast::field<args_spec>() {
+        return ast::make_field<args_spec>(std::move(*this));
     }
     #pragma endregion Casts
 
@@ -2478,20 +2415,24 @@ public:
 };
 
 
-class AsgnMod : public _ConcreteASTNode {
+class arg_spec {
 public:
     #pragma region Fields
+    identifier name;
+    field<expr> type;
+    maybe<expr> default_value;
     #pragma endregion Fields
 
     #pragma region Constructors
-    AsgnMod() {};
+    arg_spec(identifier name, field<expr> type, maybe<expr> default_value) :
+        name{std::move(name)}, type{std::move(type)}, default_value{std::move(default_value)} {}
     #pragma endregion Constructors
     
     #pragma region Service constructors
-    AsgnMod(const AsgnMod &) = delete;
-    AsgnMod(AsgnMod &&) = default;
-    AsgnMod &operator=(const AsgnMod &) = delete;
-    AsgnMod &operator=(AsgnMod &&) = default;
+    arg_spec(const arg_spec &) = delete;
+    arg_spec(arg_spec &&) = default;
+    arg_spec &operator=(const arg_spec &) = delete;
+    arg_spec &operator=(arg_spec &&) = default;
     #pragma endregion Service constructors
 
     #pragma region Uniform fields access
@@ -2500,7 +2441,7 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() {
-        return std::tie();
+        return std::tie(name, type, default_value);
     }
 
     /**
@@ -2508,14 +2449,14 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() const {
-        return std::tie();
+        return std::tie(name, type, default_value);
     }
     #pragma endregion Uniform fields access
 
     #pragma region Casts
     // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
+    operator ast::field<arg_spec>() {
+        return ast::make_field<arg_spec>(std::move(*this));
     }
     #pragma endregion Casts
 
@@ -2525,20 +2466,24 @@ public:
 };
 
 
-class AsgnLShift : public _ConcreteASTNode {
+class call_args {
 public:
     #pragma region Fields
+    sequence<call_arg> args;
+    std::optional<identifier> vararg;
+    std::optional<identifier> kwarg;
     #pragma endregion Fields
 
     #pragma region Constructors
-    AsgnLShift() {};
+    call_args(sequence<call_arg> args, std::optional<identifier> vararg, std::optional<identifier> kwarg) :
+        args{std::move(args)}, vararg{std::move(vararg)}, kwarg{std::move(kwarg)} {}
     #pragma endregion Constructors
     
     #pragma region Service constructors
-    AsgnLShift(const AsgnLShift &) = delete;
-    AsgnLShift(AsgnLShift &&) = default;
-    AsgnLShift &operator=(const AsgnLShift &) = delete;
-    AsgnLShift &operator=(AsgnLShift &&) = default;
+    call_args(const call_args &) = delete;
+    call_args(call_args &&) = default;
+    call_args &operator=(const call_args &) = delete;
+    call_args &operator=(call_args &&) = default;
     #pragma endregion Service constructors
 
     #pragma region Uniform fields access
@@ -2547,7 +2492,7 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() {
-        return std::tie();
+        return std::tie(args, vararg, kwarg);
     }
 
     /**
@@ -2555,14 +2500,14 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() const {
-        return std::tie();
+        return std::tie(args, vararg, kwarg);
     }
     #pragma endregion Uniform fields access
 
     #pragma region Casts
     // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
+    operator ast::field<call_args>() {
+        return ast::make_field<call_args>(std::move(*this));
     }
     #pragma endregion Casts
 
@@ -2572,20 +2517,23 @@ public:
 };
 
 
-class AsgnRShift : public _ConcreteASTNode {
+class call_arg {
 public:
     #pragma region Fields
+    std::optional<identifier> name;
+    field<expr> value;
     #pragma endregion Fields
 
     #pragma region Constructors
-    AsgnRShift() {};
+    call_arg(std::optional<identifier> name, field<expr> value) :
+        name{std::move(name)}, value{std::move(value)} {}
     #pragma endregion Constructors
     
     #pragma region Service constructors
-    AsgnRShift(const AsgnRShift &) = delete;
-    AsgnRShift(AsgnRShift &&) = default;
-    AsgnRShift &operator=(const AsgnRShift &) = delete;
-    AsgnRShift &operator=(AsgnRShift &&) = default;
+    call_arg(const call_arg &) = delete;
+    call_arg(call_arg &&) = default;
+    call_arg &operator=(const call_arg &) = delete;
+    call_arg &operator=(call_arg &&) = default;
     #pragma endregion Service constructors
 
     #pragma region Uniform fields access
@@ -2594,7 +2542,7 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() {
-        return std::tie();
+        return std::tie(name, value);
     }
 
     /**
@@ -2602,2329 +2550,14 @@ public:
      * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
      */
     auto get_fields_tuple() const {
-        return std::tie();
+        return std::tie(name, value);
     }
     #pragma endregion Uniform fields access
 
     #pragma region Casts
     // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnBitOr : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnBitOr() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnBitOr(const AsgnBitOr &) = delete;
-    AsgnBitOr(AsgnBitOr &&) = default;
-    AsgnBitOr &operator=(const AsgnBitOr &) = delete;
-    AsgnBitOr &operator=(AsgnBitOr &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnBitXor : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnBitXor() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnBitXor(const AsgnBitXor &) = delete;
-    AsgnBitXor(AsgnBitXor &&) = default;
-    AsgnBitXor &operator=(const AsgnBitXor &) = delete;
-    AsgnBitXor &operator=(AsgnBitXor &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class AsgnBitAnd : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    AsgnBitAnd() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    AsgnBitAnd(const AsgnBitAnd &) = delete;
-    AsgnBitAnd(AsgnBitAnd &&) = default;
-    AsgnBitAnd &operator=(const AsgnBitAnd &) = delete;
-    AsgnBitAnd &operator=(AsgnBitAnd &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class assign_op : public _AST<AsgnNone, AsgnAdd, AsgnSub, AsgnMul, AsgnDiv, AsgnMod, AsgnLShift, AsgnRShift, AsgnBitOr, AsgnBitXor, AsgnBitAnd> {
-public:
-    #pragma region Constructors
-    assign_op(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    assign_op(const assign_op &) = delete;
-    assign_op(assign_op &&) = default;
-    assign_op &operator=(const assign_op &) = delete;
-    assign_op &operator=(assign_op &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~assign_op() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<assign_op>() {
-        return ast::make_field<assign_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class And : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    And() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    And(const And &) = delete;
-    And(And &&) = default;
-    And &operator=(const And &) = delete;
-    And &operator=(And &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<bool_op>() {
-        return ast::make_field<bool_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Or : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Or() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Or(const Or &) = delete;
-    Or(Or &&) = default;
-    Or &operator=(const Or &) = delete;
-    Or &operator=(Or &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<bool_op>() {
-        return ast::make_field<bool_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class bool_op : public _AST<And, Or> {
-public:
-    #pragma region Constructors
-    bool_op(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    bool_op(const bool_op &) = delete;
-    bool_op(bool_op &&) = default;
-    bool_op &operator=(const bool_op &) = delete;
-    bool_op &operator=(bool_op &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~bool_op() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<bool_op>() {
-        return ast::make_field<bool_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Add : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Add() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Add(const Add &) = delete;
-    Add(Add &&) = default;
-    Add &operator=(const Add &) = delete;
-    Add &operator=(Add &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Sub : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Sub() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Sub(const Sub &) = delete;
-    Sub(Sub &&) = default;
-    Sub &operator=(const Sub &) = delete;
-    Sub &operator=(Sub &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Mul : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Mul() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Mul(const Mul &) = delete;
-    Mul(Mul &&) = default;
-    Mul &operator=(const Mul &) = delete;
-    Mul &operator=(Mul &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Div : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Div() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Div(const Div &) = delete;
-    Div(Div &&) = default;
-    Div &operator=(const Div &) = delete;
-    Div &operator=(Div &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Mod : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Mod() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Mod(const Mod &) = delete;
-    Mod(Mod &&) = default;
-    Mod &operator=(const Mod &) = delete;
-    Mod &operator=(Mod &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Pow : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Pow() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Pow(const Pow &) = delete;
-    Pow(Pow &&) = default;
-    Pow &operator=(const Pow &) = delete;
-    Pow &operator=(Pow &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class LShift : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    LShift() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    LShift(const LShift &) = delete;
-    LShift(LShift &&) = default;
-    LShift &operator=(const LShift &) = delete;
-    LShift &operator=(LShift &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class RShift : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    RShift() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    RShift(const RShift &) = delete;
-    RShift(RShift &&) = default;
-    RShift &operator=(const RShift &) = delete;
-    RShift &operator=(RShift &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class BitOr : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    BitOr() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    BitOr(const BitOr &) = delete;
-    BitOr(BitOr &&) = default;
-    BitOr &operator=(const BitOr &) = delete;
-    BitOr &operator=(BitOr &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class BitXor : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    BitXor() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    BitXor(const BitXor &) = delete;
-    BitXor(BitXor &&) = default;
-    BitXor &operator=(const BitXor &) = delete;
-    BitXor &operator=(BitXor &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class BitAnd : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    BitAnd() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    BitAnd(const BitAnd &) = delete;
-    BitAnd(BitAnd &&) = default;
-    BitAnd &operator=(const BitAnd &) = delete;
-    BitAnd &operator=(BitAnd &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class BidirCmp : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    BidirCmp() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    BidirCmp(const BidirCmp &) = delete;
-    BidirCmp(BidirCmp &&) = default;
-    BidirCmp &operator=(const BidirCmp &) = delete;
-    BidirCmp &operator=(BidirCmp &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class binary_op : public _AST<Add, Sub, Mul, Div, Mod, Pow, LShift, RShift, BitOr, BitXor, BitAnd, BidirCmp> {
-public:
-    #pragma region Constructors
-    binary_op(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    binary_op(const binary_op &) = delete;
-    binary_op(binary_op &&) = default;
-    binary_op &operator=(const binary_op &) = delete;
-    binary_op &operator=(binary_op &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~binary_op() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<binary_op>() {
-        return ast::make_field<binary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class BitInv : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    BitInv() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    BitInv(const BitInv &) = delete;
-    BitInv(BitInv &&) = default;
-    BitInv &operator=(const BitInv &) = delete;
-    BitInv &operator=(BitInv &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Not : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Not() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Not(const Not &) = delete;
-    Not(Not &&) = default;
-    Not &operator=(const Not &) = delete;
-    Not &operator=(Not &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class UAdd : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    UAdd() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    UAdd(const UAdd &) = delete;
-    UAdd(UAdd &&) = default;
-    UAdd &operator=(const UAdd &) = delete;
-    UAdd &operator=(UAdd &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class USub : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    USub() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    USub(const USub &) = delete;
-    USub(USub &&) = default;
-    USub &operator=(const USub &) = delete;
-    USub &operator=(USub &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class URef : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    URef() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    URef(const URef &) = delete;
-    URef(URef &&) = default;
-    URef &operator=(const URef &) = delete;
-    URef &operator=(URef &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class UStar : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    UStar() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    UStar(const UStar &) = delete;
-    UStar(UStar &&) = default;
-    UStar &operator=(const UStar &) = delete;
-    UStar &operator=(UStar &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class unary_op : public _AST<BitInv, Not, UAdd, USub, URef, UStar> {
-public:
-    #pragma region Constructors
-    unary_op(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    unary_op(const unary_op &) = delete;
-    unary_op(unary_op &&) = default;
-    unary_op &operator=(const unary_op &) = delete;
-    unary_op &operator=(unary_op &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~unary_op() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<unary_op>() {
-        return ast::make_field<unary_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Eq : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Eq() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Eq(const Eq &) = delete;
-    Eq(Eq &&) = default;
-    Eq &operator=(const Eq &) = delete;
-    Eq &operator=(Eq &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class NotEq : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    NotEq() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    NotEq(const NotEq &) = delete;
-    NotEq(NotEq &&) = default;
-    NotEq &operator=(const NotEq &) = delete;
-    NotEq &operator=(NotEq &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Lt : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Lt() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Lt(const Lt &) = delete;
-    Lt(Lt &&) = default;
-    Lt &operator=(const Lt &) = delete;
-    Lt &operator=(Lt &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class LtE : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    LtE() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    LtE(const LtE &) = delete;
-    LtE(LtE &&) = default;
-    LtE &operator=(const LtE &) = delete;
-    LtE &operator=(LtE &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Gt : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Gt() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Gt(const Gt &) = delete;
-    Gt(Gt &&) = default;
-    Gt &operator=(const Gt &) = delete;
-    Gt &operator=(Gt &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class GtE : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    GtE() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    GtE(const GtE &) = delete;
-    GtE(GtE &&) = default;
-    GtE &operator=(const GtE &) = delete;
-    GtE &operator=(GtE &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class In : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    In() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    In(const In &) = delete;
-    In(In &&) = default;
-    In &operator=(const In &) = delete;
-    In &operator=(In &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class NotIn : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    NotIn() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    NotIn(const NotIn &) = delete;
-    NotIn(NotIn &&) = default;
-    NotIn &operator=(const NotIn &) = delete;
-    NotIn &operator=(NotIn &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class cmp_op : public _AST<Eq, NotEq, Lt, LtE, Gt, GtE, In, NotIn> {
-public:
-    #pragma region Constructors
-    cmp_op(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    cmp_op(const cmp_op &) = delete;
-    cmp_op(cmp_op &&) = default;
-    cmp_op &operator=(const cmp_op &) = delete;
-    cmp_op &operator=(cmp_op &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~cmp_op() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<cmp_op>() {
-        return ast::make_field<cmp_op>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Load : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Load() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Load(const Load &) = delete;
-    Load(Load &&) = default;
-    Load &operator=(const Load &) = delete;
-    Load &operator=(Load &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<expr_context>() {
-        return ast::make_field<expr_context>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class Store : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    Store() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    Store(const Store &) = delete;
-    Store(Store &&) = default;
-    Store &operator=(const Store &) = delete;
-    Store &operator=(Store &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<expr_context>() {
-        return ast::make_field<expr_context>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class expr_context : public _AST<Load, Store> {
-public:
-    #pragma region Constructors
-    expr_context(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    expr_context(const expr_context &) = delete;
-    expr_context(expr_context &&) = default;
-    expr_context &operator=(const expr_context &) = delete;
-    expr_context &operator=(expr_context &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~expr_context() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<expr_context>() {
-        return ast::make_field<expr_context>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class args_spec {
-public:
-    #pragma region Fields
-    sequence<arg_spec> args;
-    bool with_self;
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    args_spec(sequence<arg_spec> args, bool with_self) :
-        args{std::move(args)}, with_self{std::move(with_self)} {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    args_spec(const args_spec &) = delete;
-    args_spec(args_spec &&) = default;
-    args_spec &operator=(const args_spec &) = delete;
-    args_spec &operator=(args_spec &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie(args, with_self);
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie(args, with_self);
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<args_spec>() {
-        return ast::make_field<args_spec>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class arg_spec {
-public:
-    #pragma region Fields
-    identifier name;
-    field<expr> type;
-    maybe<expr> default_value;
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    arg_spec(identifier name, field<expr> type, maybe<expr> default_value) :
-        name{std::move(name)}, type{std::move(type)}, default_value{std::move(default_value)} {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    arg_spec(const arg_spec &) = delete;
-    arg_spec(arg_spec &&) = default;
-    arg_spec &operator=(const arg_spec &) = delete;
-    arg_spec &operator=(arg_spec &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie(name, type, default_value);
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie(name, type, default_value);
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<arg_spec>() {
-        return ast::make_field<arg_spec>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class call_args {
-public:
-    #pragma region Fields
-    sequence<call_arg> args;
-    std::optional<identifier> vararg;
-    std::optional<identifier> kwarg;
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    call_args(sequence<call_arg> args, std::optional<identifier> vararg, std::optional<identifier> kwarg) :
-        args{std::move(args)}, vararg{std::move(vararg)}, kwarg{std::move(kwarg)} {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    call_args(const call_args &) = delete;
-    call_args(call_args &&) = default;
-    call_args &operator=(const call_args &) = delete;
-    call_args &operator=(call_args &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie(args, vararg, kwarg);
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie(args, vararg, kwarg);
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<call_args>() {
-        return ast::make_field<call_args>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class call_arg {
-public:
-    #pragma region Fields
-    std::optional<identifier> name;
-    field<expr> value;
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    call_arg(std::optional<identifier> name, field<expr> value) :
-        name{std::move(name)}, value{std::move(value)} {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    call_arg(const call_arg &) = delete;
-    call_arg(call_arg &&) = default;
-    call_arg &operator=(const call_arg &) = delete;
-    call_arg &operator=(call_arg &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie(name, value);
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie(name, value);
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<call_arg>() {
-        return ast::make_field<call_arg>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class CTime : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    CTime() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    CTime(const CTime &) = delete;
-    CTime(CTime &&) = default;
-    CTime &operator=(const CTime &) = delete;
-    CTime &operator=(CTime &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<xtime_flag>() {
-        return ast::make_field<xtime_flag>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class RTime : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    RTime() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    RTime(const RTime &) = delete;
-    RTime(RTime &&) = default;
-    RTime &operator=(const RTime &) = delete;
-    RTime &operator=(RTime &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<xtime_flag>() {
-        return ast::make_field<xtime_flag>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class DefaultTime : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    DefaultTime() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    DefaultTime(const DefaultTime &) = delete;
-    DefaultTime(DefaultTime &&) = default;
-    DefaultTime &operator=(const DefaultTime &) = delete;
-    DefaultTime &operator=(DefaultTime &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<xtime_flag>() {
-        return ast::make_field<xtime_flag>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class xtime_flag : public _AST<CTime, RTime, DefaultTime> {
-public:
-    #pragma region Constructors
-    xtime_flag(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    xtime_flag(const xtime_flag &) = delete;
-    xtime_flag(xtime_flag &&) = default;
-    xtime_flag &operator=(const xtime_flag &) = delete;
-    xtime_flag &operator=(xtime_flag &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~xtime_flag() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<xtime_flag>() {
-        return ast::make_field<xtime_flag>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class ByRef : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    ByRef() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    ByRef(const ByRef &) = delete;
-    ByRef(ByRef &&) = default;
-    ByRef &operator=(const ByRef &) = delete;
-    ByRef &operator=(ByRef &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<pass_kind>() {
-        return ast::make_field<pass_kind>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class ByMove : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    ByMove() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    ByMove(const ByMove &) = delete;
-    ByMove(ByMove &&) = default;
-    ByMove &operator=(const ByMove &) = delete;
-    ByMove &operator=(ByMove &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<pass_kind>() {
-        return ast::make_field<pass_kind>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class ByCopy : public _ConcreteASTNode {
-public:
-    #pragma region Fields
-    #pragma endregion Fields
-
-    #pragma region Constructors
-    ByCopy() {};
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    ByCopy(const ByCopy &) = delete;
-    ByCopy(ByCopy &&) = default;
-    ByCopy &operator=(const ByCopy &) = delete;
-    ByCopy &operator=(ByCopy &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Uniform fields access
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() {
-        return std::tie();
-    }
-
-    /**
-     * Returns a tuple of references to all fields.
-     * Note that the tuple may include sequences (std::vector) and optional fields (null unique_ptr's).
-     */
-    auto get_fields_tuple() const {
-        return std::tie();
-    }
-    #pragma endregion Uniform fields access
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<pass_kind>() {
-        return ast::make_field<pass_kind>(std::move(*this));
-    }
-    #pragma endregion Casts
-
-    #pragma region Extras
-    
-    #pragma endregion Extras
-};
-
-
-class pass_kind : public _AST<ByRef, ByMove, ByCopy> {
-public:
-    #pragma region Constructors
-    pass_kind(auto &&value_)
-        : _AST(std::forward<decltype(value_)>(value_)) {}
-    #pragma endregion Constructors
-    
-    #pragma region Service constructors
-    pass_kind(const pass_kind &) = delete;
-    pass_kind(pass_kind &&) = default;
-    pass_kind &operator=(const pass_kind &) = delete;
-    pass_kind &operator=(pass_kind &&) = default;
-    #pragma endregion Service constructors
-
-    #pragma region Destructor
-    ~pass_kind() = default;
-    #pragma endregion Destructor
-
-    #pragma region Attributes
-    
-    #pragma endregion Attributes
-
-    #pragma region Casts
-    // TODO: Explicit?
-    operator ast::field<pass_kind>() {
-        return ast::make_field<pass_kind>(std::move(*this));
+    operator ast::field<call_arg>() {
+        return ast::make_field<call_arg>(std::move(*this));
     }
     #pragma endregion Casts
 
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/ast/ast.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <concepts>
+#include <variant>
+
+
+namespace bondrewd::ast::flat {
+
+
+#pragma region Constants and typedefs
+using index_t = uint32_t;
+
+static constexpr index_t null_index = std::numeric_limits<index_t>::max();
+#pragma endregion Constants and typedefs
+
+
+#pragma region ref
+/**
+ * A reference to a row of type T, by its index in the tree's array of T's.
+ *
+ * Default-constructed refs are null (used for optional fields).
+ */
+template <typename T>
+struct ref {
+    #pragma region Constants and typedefs
+    using element_type = T;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    index_t index = null_index;
+    #pragma endregion Fields
+
+    #pragma region API
+    constexpr explicit operator bool() const noexcept {
+        return index != null_index;
+    }
+
+    constexpr bool operator==(const ref &other) const noexcept = default;
+    #pragma endregion API
+};
+#pragma endregion ref
+
+
+#pragma region node_ref
+/**
+ * A reference to an alternative of the sum type Sum.
+ *
+ * Both the alternative (kind) and the row index are packed into a single
+ * 32-bit word. The number of bits used for the kind is given by the
+ * (generated) `Sum::kind_bits`.
+ */
+template <typename Sum>
+struct node_ref {
+    #pragma region Constants and typedefs
+    using sum_type = Sum;
+    using kind_t = typename Sum::kind_t;
+
+    static constexpr unsigned index_bits = 32 - Sum::kind_bits;
+    static constexpr index_t max_index = (index_t{1} << index_bits) - 1;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    index_t bits = null_index;
+    #pragma endregion Fields
+
+    #pragma region Factories
+    static constexpr node_ref make(kind_t kind, index_t index) {
+        if (index >= max_index) {
+            throw std::length_error("Too many AST nodes of the same kind");
+        }
+
+        return node_ref{((index_t)kind << index_bits) | index};
+    }
+    #pragma endregion Factories
+
+    #pragma region API
+    constexpr kind_t kind() const noexcept {
+        return (kind_t)(bits >> index_bits);
+    }
+
+    constexpr index_t index() const noexcept {
+        return bits & max_index;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return bits != null_index;
+    }
+
+    constexpr bool operator==(const node_ref &other) const noexcept = default;
+    #pragma endregion API
+};
+#pragma endregion node_ref
+
+
+#pragma region slice
+/**
+ * A contiguous run of `size` elements of type T, starting at `offset`
+ * in the tree's shared pool of T's. Used for sequences and strings.
+ */
+template <typename T>
+struct slice {
+    #pragma region Constants and typedefs
+    using element_type = T;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    index_t offset = 0;
+    index_t size = 0;
+    #pragma endregion Fields
+
+    #pragma region API
+    constexpr bool empty() const noexcept {
+        return size == 0;
+    }
+
+    constexpr bool operator==(const slice &other) const noexcept = default;
+    #pragma endregion API
+};
+#pragma endregion slice
+
+
+#pragma region ASDL basic types
+/// Same as ast::constant, but with the string stored in the tree's character pool
+using constant = std::variant<int64_t, double, slice<char>, std::monostate>;
+#pragma endregion ASDL basic types
+
+
+#pragma region Concepts
+template <typename T>
+concept is_ref = util::specialization_of<T, ref>;
+
+template <typename T>
+concept is_node_ref = util::specialization_of<T, node_ref>;
+
+template <typename T>
+concept is_slice = util::specialization_of<T, slice>;
+
+/// Types that have a null state of their own, and thus needn't be wrapped in std::optional
+template <typename T>
+concept nullable = is_ref<T> || is_node_ref<T>;
+#pragma endregion Concepts
+
+
+#pragma region Helpers
+template <typename T>
+index_t push_row(std::vector<T> &rows, T row) {
+    if (rows.size() >= null_index) {
+        throw std::length_error("Too many AST nodes of the same kind");
+    }
+
+    rows.push_back(std::move(row));
+
+    return (index_t)(rows.size() - 1);
+}
+
+template <typename T>
+slice<T> push_slice(std::vector<T> &pool, std::span<const T> items) {
+    if (pool.size() + items.size() >= null_index) {
+        throw std::length_error("AST sequence pool overflow");
+    }
+
+    slice<T> result{(index_t)pool.size(), (index_t)items.size()};
+
+    pool.insert(pool.end(), items.begin(), items.end());
+
+    return result;
+}
+#pragma endregion Helpers
+
+
+}  // namespace bondrewd::ast::flat
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/mapped_file.hpp>
+#include <bondrewd/internal/symbol.hpp>
+#include <bondrewd/ast/ast_flat.gen.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <type_traits>
+#include <stdexcept>
+
+
+namespace bondrewd::ast::flat {
+
+
+#pragma region CacheError
+DECLARE_ERROR(CacheError, std::runtime_error);
+#pragma endregion CacheError
+
+
+#pragma region Cache format
+/**
+ * The on-disk layout of a cached flat::Tree:
+ *
+ *   FileHeader
+ *   Section[section_count]
+ *   section data, each aligned to section_alignment
+ *
+ * Sections go in the order of Tree::rows_t, then Tree::pools_t, then the
+ * identifier table (IdentifierEntry's and their text). Section data is just
+ * the raw bytes of the corresponding array, so it can be used in-place.
+ *
+ * Multi-byte values are in native byte order; caches aren't meant to be portable.
+ */
+namespace cache_format {
+
+
+static constexpr char magic[8] = {'B', 'D', 'R', 'W', 'A', 'S', 'T', '\n'};
+
+/// Bump this whenever the layout below changes
+static constexpr uint32_t version = 2;
+
+static constexpr size_t section_alignment = 16;
+
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t section_count;
+    uint64_t schema_hash;
+    uint64_t grammar_hash;
+    uint64_t source_hash;
+    uint32_t root;
+};
+
+struct Section {
+    uint64_t offset;
+    uint64_t count;
+    uint32_t elem_size;
+    uint32_t elem_align;
+};
+
+struct IdentifierEntry {
+    uint32_t offset;
+    uint32_t size;
+};
+
+
+static constexpr size_t row_sections = std::tuple_size_v<Tree::rows_t>;
+static constexpr size_t pool_sections = std::tuple_size_v<Tree::pools_t>;
+static constexpr size_t identifier_entries_section = row_sections + pool_sections;
+static constexpr size_t identifier_text_section = identifier_entries_section + 1;
+static constexpr size_t section_count = identifier_text_section + 1;
+
+
+}  // namespace cache_format
+#pragma endregion Cache format
+
+
+#pragma region Helpers
+/// Types that can be written as raw bytes. Tokens can't, since they point into the source and the symbol table
+template <typename T>
+concept cacheable = std::is_trivially_copyable_v<T> && !std::same_as<T, lex::Token>;
+
+/// FNV-1a, used to detect changes in the source
+uint64_t hash_source(std::string_view source) noexcept;
+
+template <typename T, typename Tuple>
+struct _tuple_index;
+
+template <typename T, typename ... Ts>
+struct _tuple_index<T, std::tuple<Ts...>> {
+    static constexpr size_t value = [] {
+        size_t result = 0;
+        bool found = false;
+
+        ((found = found || std::is_same_v<T, Ts>, result += !found), ...);
+
+        return result;
+    }();
+
+    static_assert(value < sizeof...(Ts), "Type not found in tuple");
+};
+#pragma endregion Helpers
+
+
+#pragma region save_cache
+/**
+ * Writes the tree to the given path (atomically, through a temporary file).
+ * grammar_hash should identify the parser that produced the tree
+ * (see parse::Parser::grammar_hash), since the AST schema alone doesn't.
+ *
+ * Throws CacheError if the tree can't be cached (e.g. it holds raw tokens,
+ * which aren't plain data) or the file can't be written.
+ */
+void save_cache(const Tree &tree, uint64_t grammar_hash, uint64_t source_hash, const std::filesystem::path &path);
+#pragma endregion save_cache
+
+
+#pragma region MappedTree
+/**
+ * A cached tree, used directly from a memory-mapped file.
+ *
+ * Opening only validates the header and the section table. The rows are
+ * then accessed in-place, and identifiers are interned on first access.
+ * Call load() to get an independent Tree instead.
+ *
+ * Note: lazy identifier interning isn't thread-safe.
+ */
+class MappedTree {
+public:
+    #pragma region Service constructors
+    MappedTree(const MappedTree &) = delete;
+    MappedTree(MappedTree &&) = default;
+    MappedTree &operator=(const MappedTree &) = delete;
+    MappedTree &operator=(MappedTree &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Factories
+    /**
+     * Returns nullopt if there's no usable cache at the given path:
+     * if it doesn't exist, is corrupt, was made from a different source
+     * (by hash), by a parser for a different grammar, or for a different
+     * AST schema or cache format.
+     */
+    static std::optional<MappedTree> open(
+        const std::filesystem::path &path,
+        uint64_t grammar_hash,
+        uint64_t source_hash,
+        util::SymbolTable &symbols = util::SymbolTable::instance
+    );
+    #pragma endregion Factories
+
+    #pragma region API
+    decltype(Tree::root) get_root() const noexcept {
+        return decltype(Tree::root){header->root};
+    }
+
+    template <typename T>
+    std::span<const T> get_rows() const {
+        return get_section<T>(_tuple_index<std::vector<T>, Tree::rows_t>::value);
+    }
+
+    template <typename T>
+    std::span<const T> get_pool() const {
+        return get_section<T>(cache_format::row_sections + _tuple_index<std::vector<T>, Tree::pools_t>::value);
+    }
+
+    template <typename T>
+    const T &operator[](ref<T> node) const {
+        assert(node);
+
+        return get_rows<T>()[node.index];
+    }
+
+    template <typename T>
+    std::span<const T> operator[](slice<T> items) const {
+        return get_pool<T>().subspan(items.offset, items.size);
+    }
+
+    identifier operator[](ref<identifier> name) const;
+
+    /// Copies everything into a standalone tree
+    Tree load() const;
+
+    /// Same as Tree::dump, but reads the rows in-place
+    std::ostream &dump(std::ostream &stream = std::cout) const {
+        return TreeDumper<MappedTree>{*this, stream}.dump(get_root());
+    }
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    util::MappedFile file;
+    const cache_format::FileHeader *header;
+    const cache_format::Section *sections;
+    util::SymbolTable *symbols;
+    mutable std::vector<identifier> identifiers{};
+    #pragma endregion Fields
+
+    #pragma region Private constructors
+    MappedTree(util::MappedFile file, util::SymbolTable &symbols);
+    #pragma endregion Private constructors
+
+    #pragma region Helpers
+    template <typename T>
+    std::span<const T> get_section(size_t idx) const {
+        const auto &section = sections[idx];
+
+        if constexpr (!cacheable<T>) {
+            // Such sections are always empty in a valid cache
+            assert(section.count == 0);
+            return {};
+        } else {
+            return std::span<const T>{reinterpret_cast<const T *>(file.data() + section.offset), (size_t)section.count};
+        }
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion MappedTree
+
+
+}  // namespace bondrewd::ast::flat
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/region.hpp>
 
 #include <memory>
 #include <concepts>
@@ -8,7 +9,11 @@
 #include <new>
 #include <vector>
 #include <stdexcept>
-#include <ranges>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <typeinfo>
+#include <iostream>
 
 
 namespace bondrewd::util {
@@ -17,8 +22,14 @@ namespace bondrewd::util {
 #pragma region Forward declarations
 class Arena;
 
-template <typename T, bondrewd::util::Arena *>
+template <typename T>
 class arena_ptr;
+
+template <typename T>
+class region_ptr;
+
+template <typename T>
+class region_allocator;
 #pragma endregion Forward declarations
 
 
@@ -26,16 +37,68 @@ class arena_ptr;
 /**
  * An arena allocator with reference counting.
  *
- * Strictly speaking, it isn't exactly an arena, since the actual objects are allocated
+ * By default, it isn't exactly an arena, since the actual objects are allocated
  * in the common heap. What it does is allocate the tracking structures in an arena,
  * allowing for less memory fragmentation than many independent shared_ptrs would
- * have caused.
+ * have caused. However, if `region_allocator` is passed as the allocator to
+ * `make_arena_ptr`, the objects themselves are carved out of the arena's Region
+ * instead. Their destructors still run as soon as the last reference is dropped,
+ * and their memory is recycled for later allocations of the same size class,
+ * but it's only given back to the heap by `reset()` and `trim()`.
+ *
+ * Finally, objects may be owned by the region outright (see `make_region_ptr`).
+ * These have no reference counts at all: they are referenced through plain
+ * non-owning region_ptr's and are only destroyed by `reset()`.
+ *
+ * The tracking structures live in a slot table. Each arena_ptr remembers the index
+ * (handle) of its slot, so reference counting never has to search for it. Released
+ * slots are put on a free-list and reused by subsequent allocations, so the table
+ * never has to be compacted either.
  *
- * Note that while it has a global instance, you may create your own arenas. The only requirement
- * is that their address must be a constant expression (i.e. they must be a global variable).
+ * Every arena also keeps a few cheap counters (see `get_stats()`), which allow
+ * to tell how much memory a parse actually used.
+ *
+ * Note that while it has a global instance, you may create your own arenas: per thread,
+ * per compilation unit, or however else is convenient. Every arena_ptr remembers the arena
+ * it came from, so arenas needn't be globals. A single arena isn't synchronized, though,
+ * so it must only be used by one thread at a time. Different arenas may be used concurrently.
  */
 class Arena {
 public:
+    #pragma region Constants and typedefs
+    using handle_t = uint32_t;
+
+    static constexpr handle_t null_handle = std::numeric_limits<handle_t>::max();
+
+    using type_id_t = uint32_t;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Statistics
+    struct TypeStats {
+        std::string name{};
+        size_t allocations{0};
+        size_t live{0};
+        size_t bytes{0};
+        size_t live_bytes{0};
+    };
+
+    struct Stats {
+        size_t total_allocations{0};
+        size_t live_allocations{0};
+        size_t peak_live_allocations{0};
+        size_t live_bytes{0};
+        size_t peak_live_bytes{0};
+        size_t region_used_bytes{0};
+        size_t region_reserved_bytes{0};
+        size_t peak_region_reserved_bytes{0};
+        size_t region_pool_hits{0};
+        size_t slot_table_size{0};
+        size_t slot_reuses{0};
+        size_t resets{0};
+        std::vector<TypeStats> per_type{};
+    };
+    #pragma endregion Statistics
+
     #pragma region Instance
     static Arena instance;
     #pragma endregion Instance
@@ -44,6 +107,12 @@ public:
     Arena() {}
     #pragma endregion Constructors
 
+    #pragma region Destructor
+    ~Arena() {
+        reset();
+    }
+    #pragma endregion Destructor
+
     #pragma region Service constructors
     // Arena can't be moved because arena_ptr's would be invalidated.
 
@@ -54,36 +123,120 @@ public:
     #pragma endregion Service constructors
 
     #pragma region Factory
-    template <typename T, bondrewd::util::Arena *arena /*= &Arena::instance*/, typename Allocator = std::allocator<T>, typename ... Args>
-    static arena_ptr<T, arena> make_arena_ptr(Args &&... args) {
-        T *ptr = Allocator{}.allocate(1);
+    template <typename T, typename Allocator = std::allocator<T>, typename ... Args>
+    static arena_ptr<T> make_arena_ptr(Arena &arena, Args &&... args) {
+        Allocator allocator = make_allocator<Allocator>(arena);
+        T *ptr = allocator.allocate(1);
+
+        try {
+            new (ptr) T{std::forward<Args>(args)...};
+        } catch (...) {
+            allocator.deallocate(ptr, 1);
+            throw;
+        }
+
+        const type_id_t type = type_id<T>();
+        handle_t handle{};
+
+        // The slot table may fail to grow, in which case nobody would own the object
+        try {
+            handle = arena.allocate_slot(ptr, &Allocation::destroy<T, Allocator>, type);
+        } catch (...) {
+            std::destroy_at(ptr);
+            allocator.deallocate(ptr, 1);
+            throw;
+        }
+
+        arena.note_allocation(type, sizeof(T));
+
+        return arena_ptr<T>{ptr, &arena, handle};
+    }
+
+    template <typename T, typename ... Args>
+    static region_ptr<T> make_region_ptr(Arena &arena, Args &&... args) {
+        T *ptr = arena.region.template allocate<T>();
 
         new (ptr) T{std::forward<Args>(args)...};
 
-        return arena_ptr<T, arena>{arena->allocations.emplace_back(ptr)};
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            arena.finalizers.push_back(Finalizer{ptr, [](void *ptr_) { std::destroy_at(static_cast<T *>(ptr_)); }});
+        }
+
+        arena.note_allocation(type_id<T>(), sizeof(T));
+
+        return region_ptr<T>{ptr};
     }
     #pragma endregion Factory
 
+    #pragma region API
+    /**
+     * Destroys all objects still owned by the arena and frees its memory in one go.
+     *
+     * Meant for dropping a whole compilation unit at once. All arena_ptr's and
+     * region_ptr's into this arena must be gone (or never used again) by then:
+     * the slot table is cleared and its handles are reused by later allocations,
+     * so touching a surviving arena_ptr afterwards (even just destroying it) is
+     * undefined behaviour. It may release an unrelated object.
+     */
+    void reset() {
+        tearing_down = true;
+
+        // In reverse, so that objects are destroyed before the ones they were built from
+        for (auto it = finalizers.rbegin(); it != finalizers.rend(); ++it) {
+            it->destroy(it->ptr);
+        }
+
+        for (auto &allocation : allocations) {
+            allocation.destroy(*this);
+        }
+
+        finalizers.clear();
+        allocations.clear();
+        free_slots.clear();
+        region.release();
+
+        tearing_down = false;
+
+        counters.live_allocations = 0;
+        counters.live_bytes = 0;
+        ++counters.resets;
+
+        for (auto &type_counters : per_type) {
+            type_counters.live = 0;
+        }
+    }
+
+    /// Frees the spare memory `reset()` keeps around for reuse
+    void trim() {
+        region.trim();
+    }
+    #pragma endregion API
+
+    #pragma region Statistics
+    Stats get_stats() const;
+
+    std::ostream &dump_stats(std::ostream &stream = std::cout) const;
+    #pragma endregion Statistics
+
 protected:
     #pragma region Helper types
     class Allocation {
     public:
         #pragma region Constructors
-        template <typename T>
-        Allocation(T *ptr) :
-            ptr{ptr},
-            deleter{[](void *ptr_) { delete static_cast<T *>(ptr_); }} {}
+        Allocation(void *ptr, void (*deleter)(Arena &, void *), type_id_t type) :
+            ptr{ptr}, deleter{deleter}, type{type} {}
         #pragma endregion Constructors
 
         #pragma region Service constructors
         Allocation(const Allocation &) = delete;
-        Allocation(Allocation &&other) : ptr{nullptr}, deleter{nullptr}, refs{0} {
+        Allocation(Allocation &&other) : ptr{nullptr}, deleter{nullptr}, type{0}, refs{0} {
             *this = std::move(other);
         }
         Allocation &operator=(const Allocation &) = delete;
         Allocation &operator=(Allocation &&other) {
             std::swap(ptr, other.ptr);
             std::swap(deleter, other.deleter);
+            std::swap(type, other.type);
             std::swap(refs, other.refs);
             return *this;
         }
@@ -91,26 +244,45 @@ protected:
 
         #pragma region Destructor
         ~Allocation() {
-            if (ptr != nullptr) {
-                deleter(ptr);
-            }
+            // The owning arena must have destroyed the object already
+            assert(ptr == nullptr);
+        }
+        #pragma endregion Destructor
+
+        #pragma region Deleters
+        template <typename T, typename Allocator>
+        static void destroy(Arena &arena, void *ptr) {
+            T *obj = static_cast<T *>(ptr);
 
+            std::destroy_at(obj);
+            make_allocator<Allocator>(arena).deallocate(obj, 1);
+        }
+        #pragma endregion Deleters
+
+        #pragma region API
+        void destroy(Arena &arena) {
             if (refs != 0) {
                 ERR("WARNING: Arena destroyed with a dangling reference! (%p, refs=%u)\n", ptr, refs);
+                refs = 0;
+            }
+
+            if (ptr != nullptr) {
+                void *ptr_ = ptr;
+                ptr = nullptr;
+                deleter(arena, ptr_);
             }
         }
-        #pragma endregion Destructor
 
-        #pragma region API
         void *take() {
             ++refs;
             return ptr;
         }
 
-        bool release() {
+        bool release(Arena &arena) {
             if (--refs == 0) {
-                deleter(ptr);
+                void *ptr_ = ptr;
                 ptr = nullptr;
+                deleter(arena, ptr_);
                 return true;
             }
 
@@ -125,6 +297,10 @@ protected:
             return refs;
         }
 
+        constexpr type_id_t get_type() const {
+            return type;
+        }
+
         constexpr operator bool() const {
             return ptr != nullptr;
         }
@@ -133,82 +309,171 @@ protected:
     protected:
         #pragma region Fields
         void *ptr;
-        void (*deleter)(void *);
+        void (*deleter)(Arena &, void *);
+        type_id_t type;
         unsigned refs = 0;
         #pragma endregion Fields
     };
 
-    template <typename, Arena *>
+    template <typename>
     friend class arena_ptr;
+
+    template <typename>
+    friend class region_allocator;
+
+    struct Finalizer {
+        void *ptr;
+        void (*destroy)(void *);
+    };
+
+    struct Counters {
+        size_t total_allocations{0};
+        size_t live_allocations{0};
+        size_t peak_live_allocations{0};
+        size_t live_bytes{0};
+        size_t peak_live_bytes{0};
+        size_t slot_reuses{0};
+        size_t resets{0};
+    };
+
+    struct TypeCounters {
+        size_t allocations{0};
+        size_t live{0};
+        size_t size{0};
+    };
     #pragma endregion Helper types
 
     #pragma region Fields
     std::vector<Allocation> allocations{};
+    std::vector<handle_t> free_slots{};
+    std::vector<Finalizer> finalizers{};
+    Region region{};
+    bool tearing_down = false;
+    Counters counters{};
+    std::vector<TypeCounters> per_type{};
     #pragma endregion Fields
 
-    #pragma region arena_ptr API
-    void arena_ptr_incref(void *ptr) {
-        if (!ptr) return;
+    #pragma region Type registry
+    /**
+     * Registers a type globally (for all arenas), returning its id. Defined in arena.cpp.
+     *
+     * The registry is shared between threads, so it's guarded by a mutex. It's only
+     * consulted on the first allocation of each type and when building statistics,
+     * so the lock is never taken on the hot path.
+     */
+    static type_id_t register_type(const std::type_info &info);
+
+    static const std::type_info &get_type_info(type_id_t type);
 
-        auto &allocation = find_allocation(ptr);
+    template <typename T>
+    static type_id_t type_id() {
+        static const type_id_t id = register_type(typeid(T));
 
-        allocation.take();
+        return id;
     }
+    #pragma endregion Type registry
 
-    void arena_ptr_decref(void *ptr) {
-        static int recursion_depth = 0;
+    #pragma region Counting
+    void note_allocation(type_id_t type, size_t size) {
+        if (type >= per_type.size()) {
+            per_type.resize(type + 1);
+        }
+
+        ++per_type[type].allocations;
+        ++per_type[type].live;
+        per_type[type].size = size;
+
+        ++counters.total_allocations;
+        counters.live_bytes += size;
+        counters.peak_live_bytes = std::max(counters.peak_live_bytes, counters.live_bytes);
+        counters.peak_live_allocations = std::max(counters.peak_live_allocations, ++counters.live_allocations);
+    }
+
+    void note_release(type_id_t type) {
+        --per_type[type].live;
 
-        if (!ptr) return;
+        --counters.live_allocations;
+        counters.live_bytes -= per_type[type].size;
+    }
+    #pragma endregion Counting
 
-        ++recursion_depth;
+    #pragma region Slot management
+    handle_t allocate_slot(void *ptr, void (*deleter)(Arena &, void *), type_id_t type) {
+        if (!free_slots.empty()) {
+            handle_t handle = free_slots.back();
+            free_slots.pop_back();
 
-        auto &allocation = find_allocation(ptr);
+            assert(!allocations[handle]);
+            allocations[handle] = Allocation{ptr, deleter, type};
+            ++counters.slot_reuses;
 
-        if (allocation.release() && recursion_depth == 1) {
-            // Remove all null allocations
-            allocations.erase(
-                std::remove_if(allocations.begin(), allocations.end(), [](auto &allocation_) {
-                    return !allocation_;
-                }),
-                allocations.end()
-            );
+            return handle;
+        }
 
+        if (allocations.size() >= null_handle) {
+            throw std::length_error("Arena slot table overflow");
         }
 
-        --recursion_depth;
+        allocations.emplace_back(ptr, deleter, type);
+
+        return (handle_t)(allocations.size() - 1);
     }
 
-    bool arena_ptr_is_unique(void *ptr) {
-        if (!ptr) return true;
+    Allocation &get_allocation(handle_t handle) {
+        assert(handle < allocations.size());
+        assert(allocations[handle]);
 
-        auto &allocation = find_allocation(ptr);
+        return allocations[handle];
+    }
+    #pragma endregion Slot management
 
-        return allocation.get_refs() == 1;
+    #pragma region arena_ptr API
+    void arena_ptr_incref(handle_t handle) {
+        if (handle == null_handle) return;
+
+        get_allocation(handle).take();
     }
 
-    Allocation &find_allocation(void *ptr) {
-        // TODO: Speed up with a map?
-        // For now, my optimization is to search backwards, since the most recent allocations
-        // are the most likely to be referenced. This is, strictly speaking, not true for
-        // destructor calls at the end of the program, but performance isn't really a concern
-        // at that point.
-        for (auto &allocation : std::ranges::views::reverse(allocations)) {
-            if (allocation.get_raw() == ptr) {
-                return allocation;
-            }
+    void arena_ptr_decref(handle_t handle) {
+        // While tearing down, objects are destroyed regardless of their references
+        if (handle == null_handle || tearing_down) return;
+
+        // Note: the release may recursively decref other slots (when the destroyed
+        // object owns arena_ptr's itself), but it never allocates new ones, so
+        // the reference stays valid.
+        Allocation &allocation = get_allocation(handle);
+
+        if (allocation.release(*this)) {
+            note_release(allocation.get_type());
+            free_slots.push_back(handle);
         }
+    }
+
+    bool arena_ptr_is_unique(handle_t handle) {
+        if (handle == null_handle) return true;
 
-        ERR("WARNING: Arena reference to a dangling pointer! (%p)\n", ptr);
-        abort();  // TODO: Maybe less harsh?
+        return get_allocation(handle).get_refs() == 1;
     }
     #pragma endregion arena_ptr API
 
+    #pragma region Allocator helpers
+    /// Allocators that need to know their arena (like region_allocator) are constructed from it
+    template <typename Allocator>
+    static Allocator make_allocator(Arena &arena) {
+        if constexpr (std::constructible_from<Allocator, Arena &>) {
+            return Allocator{arena};
+        } else {
+            return Allocator{};
+        }
+    }
+    #pragma endregion Allocator helpers
+
 };
 #pragma endregion Arena
 
 
 #pragma region arena_ptr
-template <typename T, bondrewd::util::Arena *arena = &Arena::instance>
+template <typename T>
 class arena_ptr {
 public:
     #pragma region Constants and typedefs
@@ -216,25 +481,30 @@ public:
     #pragma endregion Constants and typedefs
 
     #pragma region Constructors
-    arena_ptr() : ptr{nullptr} {};
+    arena_ptr() : ptr{nullptr}, arena{nullptr}, handle{Arena::null_handle} {};
 
     arena_ptr(nullptr_t) : arena_ptr() {};
     #pragma endregion Constructors
 
     #pragma region Service constructors
-    arena_ptr(const arena_ptr &other) : ptr{other.ptr} {
-        arena->arena_ptr_incref(ptr);
+    arena_ptr(const arena_ptr &other) : ptr{other.ptr}, arena{other.arena}, handle{other.handle} {
+        incref();
     }
 
-    arena_ptr(arena_ptr &&other) : ptr{other.ptr} {
+    arena_ptr(arena_ptr &&other) : ptr{other.ptr}, arena{other.arena}, handle{other.handle} {
         other.ptr = nullptr;
+        other.arena = nullptr;
+        other.handle = Arena::null_handle;
     }
 
     arena_ptr &operator=(const arena_ptr &other) {
+        // Note: handles are only unique within an arena, so pointers are compared instead
         if (ptr != other.ptr) {
-            arena->arena_ptr_decref(ptr);
+            decref();
             ptr = other.ptr;
-            arena->arena_ptr_incref(ptr);
+            arena = other.arena;
+            handle = other.handle;
+            incref();
         }
 
         return *this;
@@ -242,9 +512,13 @@ public:
 
     arena_ptr &operator=(arena_ptr &&other) {
         if (this != &other) {
-            arena->arena_ptr_decref(ptr);
+            decref();
             ptr = other.ptr;
+            arena = other.arena;
+            handle = other.handle;
             other.ptr = nullptr;
+            other.arena = nullptr;
+            other.handle = Arena::null_handle;
         }
 
         return *this;
@@ -253,25 +527,32 @@ public:
 
     #pragma region Destructor
     ~arena_ptr() {
-        arena->arena_ptr_decref(ptr);
-        ptr = nullptr;
+        reset();
     }
     #pragma endregion Destructor
 
     #pragma region API
     void reset() {
-        arena->arena_ptr_decref(ptr);
+        decref();
         ptr = nullptr;
+        arena = nullptr;
+        handle = Arena::null_handle;
     }
 
     void swap(arena_ptr &other) noexcept {
         std::swap(ptr, other.ptr);
+        std::swap(arena, other.arena);
+        std::swap(handle, other.handle);
     }
 
     T *get() const noexcept {
         return ptr;
     }
 
+    Arena *get_arena() const noexcept {
+        return arena;
+    }
+
     operator bool() const noexcept {
         return ptr != nullptr;
     }
@@ -288,15 +569,12 @@ public:
         return ptr <=> other.ptr;
     }
 
-    bool operator==(const arena_ptr &other) const noexcept = default;
-    bool operator!=(const arena_ptr &other) const noexcept = default;
-    bool operator<=(const arena_ptr &other) const noexcept = default;
-    bool operator>=(const arena_ptr &other) const noexcept = default;
-    bool operator< (const arena_ptr &other) const noexcept = default;
-    bool operator> (const arena_ptr &other) const noexcept = default;
+    bool operator==(const arena_ptr &other) const noexcept {
+        return ptr == other.ptr;
+    }
 
     bool is_unique() const {
-        return arena->is_unique(ptr);
+        return arena == nullptr || arena->arena_ptr_is_unique(handle);
     }
     #pragma endregion API
 
@@ -305,13 +583,28 @@ public:
 protected:
     #pragma region Fields
     T *ptr;
+    Arena *arena;
+    Arena::handle_t handle;
     #pragma endregion Fields
 
     #pragma region Private constructors
-    arena_ptr(Arena::Allocation &allocation) :
-        ptr{static_cast<T *>(allocation.take())} {}
+    arena_ptr(T *ptr, Arena *arena, Arena::handle_t handle) :
+        ptr{ptr}, arena{arena}, handle{handle} {
+
+        incref();
+    }
     #pragma endregion Private constructors
 
+    #pragma region Helpers
+    void incref() {
+        if (arena) arena->arena_ptr_incref(handle);
+    }
+
+    void decref() {
+        if (arena) arena->arena_ptr_decref(handle);
+    }
+    #pragma endregion Helpers
+
     #pragma region Friends
     friend class Arena;
     #pragma endregion Friends
@@ -320,17 +613,168 @@ protected:
 #pragma endregion arena_ptr
 
 
+#pragma region region_ptr
+/**
+ * A non-owning pointer to an object owned by an arena's region.
+ *
+ * Copies, moves and destruction are all free; the pointee lives until
+ * the arena is reset. Mirrors the arena_ptr interface, so that the two
+ * may be used interchangeably.
+ */
+template <typename T>
+class region_ptr {
+public:
+    #pragma region Constants and typedefs
+    using element_type = T;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    region_ptr() : ptr{nullptr} {};
+
+    region_ptr(nullptr_t) : region_ptr() {};
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    region_ptr(const region_ptr &other) = default;
+    region_ptr(region_ptr &&other) = default;
+    region_ptr &operator=(const region_ptr &other) = default;
+    region_ptr &operator=(region_ptr &&other) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Destructor
+    ~region_ptr() = default;
+    #pragma endregion Destructor
+
+    #pragma region API
+    void reset() {
+        ptr = nullptr;
+    }
+
+    void swap(region_ptr &other) noexcept {
+        std::swap(ptr, other.ptr);
+    }
+
+    T *get() const noexcept {
+        return ptr;
+    }
+
+    operator bool() const noexcept {
+        return ptr != nullptr;
+    }
+
+    T &operator*() const noexcept {
+        return *ptr;
+    }
+
+    T *operator->() const noexcept {
+        return ptr;
+    }
+
+    auto operator<=>(const region_ptr &other) const noexcept {
+        return ptr <=> other.ptr;
+    }
+
+    bool operator==(const region_ptr &other) const noexcept = default;
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    T *ptr;
+    #pragma endregion Fields
+
+    #pragma region Private constructors
+    explicit region_ptr(T *ptr) :
+        ptr{ptr} {}
+    #pragma endregion Private constructors
+
+    #pragma region Friends
+    friend class Arena;
+    #pragma endregion Friends
+
+};
+#pragma endregion region_ptr
+
+
+#pragma region region_allocator
+/**
+ * An allocator that carves objects out of an arena's Region.
+ *
+ * Deallocated small blocks are recycled through the region's size class
+ * free-lists; the rest of the memory is reclaimed by `Arena::reset()`.
+ */
+template <typename T>
+class region_allocator {
+public:
+    #pragma region Constants and typedefs
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = region_allocator<U>;
+    };
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    region_allocator(Arena &arena) :
+        arena{&arena} {}
+
+    template <typename U>
+    region_allocator(const region_allocator<U> &other) :
+        arena{other.arena} {}
+    #pragma endregion Constructors
+
+    #pragma region API
+    T *allocate(size_t count) {
+        return arena->region.template allocate<T>(count);
+    }
+
+    void deallocate(T *ptr, size_t count) noexcept {
+        arena->region.deallocate(ptr, count);
+    }
+
+    Arena &get_arena() const noexcept {
+        return *arena;
+    }
+
+    bool operator==(const region_allocator &) const noexcept = default;
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    Arena *arena;
+    #pragma endregion Fields
+
+    #pragma region Friends
+    template <typename>
+    friend class region_allocator;
+    #pragma endregion Friends
+
+};
+#pragma endregion region_allocator
+
+
 #pragma region make_arena_ptr
-template <typename T, Arena *arena /*= &Arena::instance*/, typename Allocator = std::allocator<T>, typename ... Args>
-arena_ptr<T, arena> make_arena_ptr(Args &&... args) {
-    return Arena::make_arena_ptr<T, arena, Allocator>(std::forward<Args>(args)...);
+template <typename T, typename Allocator = std::allocator<T>, typename ... Args>
+arena_ptr<T> make_arena_ptr(Arena &arena, Args &&... args) {
+    return Arena::make_arena_ptr<T, Allocator>(arena, std::forward<Args>(args)...);
 }
 #pragma endregion make_arena_ptr
 
 
+#pragma region make_region_ptr
+template <typename T, typename ... Args>
+region_ptr<T> make_region_ptr(Arena &arena, Args &&... args) {
+    return Arena::make_region_ptr<T>(arena, std::forward<Args>(args)...);
+}
+#pragma endregion make_region_ptr
+
+
 #pragma region Concepts
-template <typename T, Arena *arena>
-concept arena_ptr_at = std::same_as<std::decay_t<T>, arena_ptr<typename T::element_type, arena>>;
+template <typename T>
+concept is_arena_ptr = specialization_of<std::decay_t<T>, arena_ptr>;
+
+template <typename T>
+concept is_region_ptr = specialization_of<std::decay_t<T>, region_ptr>;
 #pragma endregion Concepts
 
 
@@ -341,15 +785,29 @@ concept arena_ptr_at = std::same_as<std::decay_t<T>, arena_ptr<typename T::eleme
 namespace std {
 
 
-template <typename T, bondrewd::util::Arena *arena>
-void swap(bondrewd::util::arena_ptr<T, arena> &a, bondrewd::util::arena_ptr<T, arena> &b) noexcept {
+template <typename T>
+void swap(bondrewd::util::arena_ptr<T> &a, bondrewd::util::arena_ptr<T> &b) noexcept {
+    a.swap(b);
+}
+
+
+template <typename T>
+struct hash<bondrewd::util::arena_ptr<T>> {
+    size_t operator()(const bondrewd::util::arena_ptr<T> &x) const {
+        return std::hash<T *>()(x.get());
+    }
+};
+
+
+template <typename T>
+void swap(bondrewd::util::region_ptr<T> &a, bondrewd::util::region_ptr<T> &b) noexcept {
     a.swap(b);
 }
 
 
-template <typename T, bondrewd::util::Arena *arena>
-struct hash<bondrewd::util::arena_ptr<T, arena>> {
-    size_t operator()(const bondrewd::util::arena_ptr<T, arena> &x) const {
+template <typename T>
+struct hash<bondrewd::util::region_ptr<T>> {
+    size_t operator()(const bondrewd::util::region_ptr<T> &x) const {
         return std::hash<T *>()(x.get());
     }
 };
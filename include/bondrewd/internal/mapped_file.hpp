@@ -0,0 +1,101 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+
+#include <filesystem>
+#include <string_view>
+#include <memory>
+#include <stdexcept>
+
+
+namespace bondrewd::util {
+
+
+#pragma region FileError
+DECLARE_ERROR(FileError, std::runtime_error);
+#pragma endregion FileError
+
+
+#pragma region MappedFile
+/**
+ * A read-only view of a whole file's contents.
+ *
+ * On POSIX systems regular files are memory-mapped, so nothing is read until it's
+ * actually accessed. Anything else (pipes, FIFOs, /dev/stdin, /proc files), or
+ * a file that can't be mapped, is read into a buffer until EOF.
+ */
+class MappedFile {
+public:
+    #pragma region Constructors
+    MappedFile() noexcept = default;
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept :
+        data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, 0)},
+        mapped{std::exchange(other.mapped, false)},
+        buffer{std::move(other.buffer)} {}
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile &operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            close();
+
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            mapped = std::exchange(other.mapped, false);
+            buffer = std::move(other.buffer);
+        }
+
+        return *this;
+    }
+    #pragma endregion Service constructors
+
+    #pragma region Destructor
+    ~MappedFile() {
+        close();
+    }
+    #pragma endregion Destructor
+
+    #pragma region Factories
+    /// Throws FileError if the file can't be opened
+    static MappedFile open(const std::filesystem::path &path);
+    #pragma endregion Factories
+
+    #pragma region API
+    const char *data() const noexcept {
+        return data_;
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    std::string_view view() const noexcept {
+        return std::string_view{data_, size_};
+    }
+
+    bool is_mapped() const noexcept {
+        return mapped;
+    }
+
+    void close() noexcept;
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped = false;
+    std::unique_ptr<char[]> buffer{};
+    #pragma endregion Fields
+
+};
+#pragma endregion MappedFile
+
+
+}  // namespace bondrewd::util
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+
+#include <memory>
+#include <vector>
+#include <new>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+
+
+namespace bondrewd::util {
+
+
+#pragma region Region
+/**
+ * A chunked bump-pointer allocator.
+ *
+ * Memory is carved out of large contiguous chunks, and is only given back
+ * to the heap all at once, by `release()` (or the destructor). Objects allocated
+ * here are NOT destroyed by the region itself; that is the responsibility of the
+ * owner (see Arena).
+ *
+ * Small blocks are grouped into size classes. A block that is deallocated goes
+ * onto the free-list of its class, and the next allocation of that class just
+ * pops it, which is how released AST nodes are recycled. Larger blocks (and those
+ * from `allocate_unpooled()`) are simply abandoned until `release()`.
+ *
+ * `release()` keeps the regular chunks around as spares, so rebuilding a tree of
+ * about the same size (e.g. re-parsing a file in watch mode) never goes back to
+ * the heap. `trim()` frees the spares.
+ */
+class Region {
+public:
+    #pragma region Constants and typedefs
+    static constexpr size_t default_chunk_size = 64 * 1024;
+
+    /// Allocations larger than this fraction of a chunk get a dedicated chunk
+    static constexpr size_t oversized_ratio = 4;
+
+    /// Size class granularity. Pooled blocks are aligned to it as well
+    static constexpr size_t size_class_step = alignof(std::max_align_t);
+
+    static constexpr size_t size_class_count = 32;
+
+    /// Blocks larger than this aren't pooled
+    static constexpr size_t max_pooled_size = size_class_step * size_class_count;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    Region(size_t chunk_size = default_chunk_size) :
+        chunk_size{chunk_size} {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    Region(const Region &) = delete;
+    Region(Region &&) = default;
+    Region &operator=(const Region &) = delete;
+    Region &operator=(Region &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region API
+    void *allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+        if (size == 0) {
+            size = 1;
+        }
+
+        if (is_pooled(size, alignment)) {
+            const size_t size_class = get_size_class(size);
+
+            if (FreeBlock *block = free_lists[size_class]) {
+                free_lists[size_class] = block->next;
+                ++pool_hits;
+                return block;
+            }
+
+            // Rounded up, so that the block may later be reused by any request of the same class
+            size = (size_class + 1) * size_class_step;
+            alignment = size_class_step;
+        }
+
+        return allocate_bump(size, alignment);
+    }
+
+    template <typename T>
+    T *allocate(size_t count = 1) {
+        return static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * Allocates exactly `size` bytes, bypassing the size classes, so that
+     * e.g. short strings can be packed back to back.
+     *
+     * Such blocks must NOT be passed to `deallocate()`; they are only freed
+     * by `release()`.
+     */
+    void *allocate_unpooled(size_t size, size_t alignment = 1) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+        if (size == 0) {
+            size = 1;
+        }
+
+        return allocate_bump(size, alignment);
+    }
+
+    template <typename T>
+    T *allocate_unpooled(size_t count = 1) {
+        return static_cast<T *>(allocate_unpooled(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * Gives a block back for reuse. `size` and `alignment` must match the allocation.
+     *
+     * Only small blocks are actually recycled; for the rest, this is a no-op.
+     */
+    void deallocate(void *ptr, size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        if (size == 0) {
+            size = 1;
+        }
+
+        if (!is_pooled(size, alignment)) {
+            return;
+        }
+
+        const size_t size_class = get_size_class(size);
+
+        FreeBlock *block = new (ptr) FreeBlock{free_lists[size_class]};
+        free_lists[size_class] = block;
+    }
+
+    template <typename T>
+    void deallocate(T *ptr, size_t count = 1) noexcept {
+        deallocate((void *)ptr, sizeof(T) * count, alignof(T));
+    }
+
+    /**
+     * Frees all the memory at once.
+     *
+     * The regular chunks are kept around as spares, so that a region that is reused
+     * (e.g. for parsing one file after another) doesn't go back to the heap
+     * on every cycle. Oversized chunks are freed right away.
+     */
+    void release() {
+        for (auto &chunk : chunks) {
+            if (chunk.size == chunk_size) {
+                spare_chunks.push_back(std::move(chunk));
+            }
+        }
+
+        chunks.clear();
+        free_lists.fill(nullptr);
+        cur = end = nullptr;
+        used_bytes = 0;
+        reserved_bytes = spare_chunks.size() * chunk_size;
+    }
+
+    /// Frees the spare chunks kept by `release()`
+    void trim() {
+        reserved_bytes -= spare_chunks.size() * chunk_size;
+        spare_chunks.clear();
+    }
+
+    size_t get_used_bytes() const noexcept {
+        return used_bytes;
+    }
+
+    size_t get_reserved_bytes() const noexcept {
+        return reserved_bytes;
+    }
+
+    size_t get_peak_reserved_bytes() const noexcept {
+        return peak_reserved_bytes;
+    }
+
+    /// The number of allocations served from the size class free-lists
+    size_t get_pool_hits() const noexcept {
+        return pool_hits;
+    }
+    #pragma endregion API
+
+protected:
+    #pragma region Helper types
+    struct Chunk {
+        std::unique_ptr<std::byte[]> data{};
+        size_t size{0};
+    };
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+    #pragma endregion Helper types
+
+    #pragma region Fields
+    size_t chunk_size;
+    std::vector<Chunk> chunks{};
+    std::vector<Chunk> spare_chunks{};
+    std::array<FreeBlock *, size_class_count> free_lists{};
+    std::byte *cur{nullptr};
+    std::byte *end{nullptr};
+    size_t used_bytes{0};
+    size_t reserved_bytes{0};
+    size_t peak_reserved_bytes{0};
+    size_t pool_hits{0};
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    static constexpr uintptr_t align_up(uintptr_t value, size_t alignment) {
+        return (value + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    }
+
+    static constexpr bool is_pooled(size_t size, size_t alignment) {
+        return size <= max_pooled_size && alignment <= size_class_step;
+    }
+
+    static constexpr size_t get_size_class(size_t size) {
+        return (size - 1) / size_class_step;
+    }
+
+    void new_chunk(size_t size) {
+        if (size == chunk_size && !spare_chunks.empty()) {
+            Chunk &chunk = chunks.emplace_back(std::move(spare_chunks.back()));
+            spare_chunks.pop_back();
+
+            // Already accounted for in reserved_bytes
+            cur = chunk.data.get();
+            end = cur + size;
+            return;
+        }
+
+        Chunk &chunk = chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size), size);
+
+        reserved_bytes += size;
+        peak_reserved_bytes = std::max(peak_reserved_bytes, reserved_bytes);
+        cur = chunk.data.get();
+        end = cur + size;
+    }
+
+    void *allocate_bump(size_t size, size_t alignment) {
+        if (size + alignment > chunk_size / oversized_ratio) {
+            return allocate_oversized(size, alignment);
+        }
+
+        uintptr_t aligned = align_up((uintptr_t)cur, alignment);
+
+        if (cur == nullptr || aligned + size > (uintptr_t)end) {
+            new_chunk(chunk_size);
+            aligned = align_up((uintptr_t)cur, alignment);
+        }
+
+        cur = (std::byte *)(aligned + size);
+        used_bytes += size;
+
+        return (void *)aligned;
+    }
+
+    void *allocate_oversized(size_t size, size_t alignment) {
+        // A dedicated chunk, so that the current one isn't wasted.
+        // Note that it's inserted before the current chunk, which stays last.
+        const size_t total = size + alignment;
+
+        auto pos = chunks.empty() ? chunks.end() : chunks.end() - 1;
+        Chunk &chunk = *chunks.emplace(pos, std::make_unique_for_overwrite<std::byte[]>(total), total);
+
+        reserved_bytes += total;
+        peak_reserved_bytes = std::max(peak_reserved_bytes, reserved_bytes);
+        used_bytes += size;
+
+        return (void *)align_up((uintptr_t)chunk.data.get(), alignment);
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion Region
+
+
+}  // namespace bondrewd::util
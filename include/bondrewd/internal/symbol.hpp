@@ -0,0 +1,195 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/region.hpp>
+
+#include <string_view>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+#include <compare>
+#include <iostream>
+
+
+namespace bondrewd::util {
+
+
+#pragma region Forward declarations
+class SymbolTable;
+#pragma endregion Forward declarations
+
+
+#pragma region Symbol
+/**
+ * An interned string.
+ *
+ * Symbols from the same table are equal if and only if their texts are,
+ * so comparing them is a single pointer comparison. The text itself is
+ * shared by all occurrences, and lives as long as the table does.
+ *
+ * Every symbol also has a dense numeric id, which is handy for indexing
+ * per-symbol tables. The default-constructed symbol is empty and has no id.
+ */
+class Symbol {
+public:
+    #pragma region Constants and typedefs
+    using id_t = uint32_t;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    constexpr Symbol() noexcept : entry{nullptr} {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    constexpr Symbol(const Symbol &) noexcept = default;
+    constexpr Symbol(Symbol &&) noexcept = default;
+    constexpr Symbol &operator=(const Symbol &) noexcept = default;
+    constexpr Symbol &operator=(Symbol &&) noexcept = default;
+    #pragma endregion Service constructors
+
+    #pragma region API
+    std::string_view str() const noexcept {
+        return entry ? entry->text : std::string_view{};
+    }
+
+    operator std::string_view() const noexcept {
+        return str();
+    }
+
+    id_t get_id() const noexcept {
+        assert(entry);
+
+        return entry->id;
+    }
+
+    bool empty() const noexcept {
+        return entry == nullptr;
+    }
+
+    explicit operator bool() const noexcept {
+        return entry != nullptr;
+    }
+
+    bool operator==(const Symbol &other) const noexcept = default;
+
+    /// Note: orders by interning order, not alphabetically
+    std::strong_ordering operator<=>(const Symbol &other) const noexcept {
+        if (!entry || !other.entry) {
+            return (bool)entry <=> (bool)other.entry;
+        }
+
+        return entry->id <=> other.entry->id;
+    }
+
+    /// Slow path, for comparisons against literal text (e.g. soft keywords)
+    bool operator==(std::string_view other) const noexcept {
+        return str() == other;
+    }
+    #pragma endregion API
+
+    #pragma region Debug
+    std::ostream &dump(std::ostream &stream = std::cout) const {
+        return stream << str();
+    }
+    #pragma endregion Debug
+
+protected:
+    #pragma region Helper types
+    struct Entry {
+        std::string_view text;
+        id_t id;
+    };
+    #pragma endregion Helper types
+
+    #pragma region Fields
+    const Entry *entry;
+    #pragma endregion Fields
+
+    #pragma region Private constructors
+    explicit constexpr Symbol(const Entry *entry) noexcept :
+        entry{entry} {}
+    #pragma endregion Private constructors
+
+    #pragma region Friends
+    friend class SymbolTable;
+
+    friend struct std::hash<Symbol>;
+    #pragma endregion Friends
+
+};
+
+
+inline std::ostream &operator<<(std::ostream &stream, const Symbol &symbol) {
+    return symbol.dump(stream);
+}
+#pragma endregion Symbol
+
+
+#pragma region SymbolTable
+/**
+ * Interns strings into Symbols.
+ *
+ * The global instance is shared by the tokenizer and the AST, but you may create
+ * separate tables (e.g. one per compilation). Symbols from different tables
+ * must not be mixed, though.
+ *
+ * Interning is thread-safe. Already known names only take a shared lock,
+ * and reading a symbol's text never locks at all.
+ */
+class SymbolTable {
+public:
+    #pragma region Instance
+    static SymbolTable instance;
+    #pragma endregion Instance
+
+    #pragma region Constructors
+    SymbolTable() {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    // Can't be moved, because symbols point into it
+
+    SymbolTable(const SymbolTable &) = delete;
+    SymbolTable(SymbolTable &&) = delete;
+    SymbolTable &operator=(const SymbolTable &) = delete;
+    SymbolTable &operator=(SymbolTable &&) = delete;
+    #pragma endregion Service constructors
+
+    #pragma region API
+    /// Returns the symbol for the given text, creating it if needed
+    Symbol intern(std::string_view text);
+
+    /// Returns the symbol for the given text, or an empty one if it hasn't been interned
+    Symbol find(std::string_view text) const;
+
+    size_t size() const;
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    mutable std::shared_mutex mutex{};
+    std::unordered_map<std::string_view, const Symbol::Entry *> index{};
+    Region storage{};
+    #pragma endregion Fields
+
+};
+#pragma endregion SymbolTable
+
+
+}  // namespace bondrewd::util
+
+
+#pragma region std specializations
+namespace std {
+
+
+template <>
+struct hash<bondrewd::util::Symbol> {
+    size_t operator()(const bondrewd::util::Symbol &x) const {
+        return std::hash<const void *>()(x.entry);
+    }
+};
+
+
+}  // namespace std
+#pragma endregion std specializations
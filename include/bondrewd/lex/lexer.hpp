@@ -2,6 +2,7 @@
 
 #include <bondrewd/internal/common.hpp>
 #include <bondrewd/lex/tokenizer.hpp>
+#include <bondrewd/lex/token_buffer.hpp>
 
 #include <vector>
 #include <iostream>
@@ -13,11 +14,28 @@ namespace bondrewd::lex {
 
 /**
  * A caching wrapper over a Tokenizer.
+ *
+ * Tokens are kept packed in a TokenBuffer. Matching against them doesn't
+ * build Tokens at all, only successful matches and explicit accesses do.
+ *
+ * Tokens are normally pulled from the tokenizer as the parser gets to them,
+ * but the whole input may also be lexed up front (see tokenize_all() and
+ * pretokenize()), so that the parser only indexes into a finished array.
+ *
+ * The parser may also promise not to seek back before some position anymore
+ * (see retire_before()), which lets the lexer drop the tokens before it, along
+ * with the input they came from when streaming. States stay absolute regardless.
  */
 class Lexer {
 public:
     #pragma region Constants and typedefs
     using state_t = size_t;
+
+    /// Files smaller than this aren't worth splitting between threads
+    static constexpr size_t min_parallel_chunk_size = 256 * 1024;
+
+    /// Retired tokens are only dropped this many at a time (or more), since that moves the rest
+    static constexpr size_t min_retire_batch = 4096;
     #pragma endregion Constants and typedefs
 
     #pragma region Constructors
@@ -44,21 +62,49 @@ public:
     static Lexer from_file(std::filesystem::path filename) {
         return Lexer{Tokenizer::from_file(filename)};
     }
+
+    static Lexer from_buffer(SourceBuffer::ptr_t source) {
+        return Lexer{Tokenizer::from_buffer(std::move(source))};
+    }
+
+    /**
+     * Lexes the whole buffer right away. Large buffers are split into chunks
+     * at newlines outside of strings and comments, which are lexed on up to
+     * max_threads threads (0 means one per core), and then stitched together.
+     *
+     * Unlike with lazy lexing, any LexicalError is thrown from here.
+     */
+    static Lexer pretokenize(SourceBuffer::ptr_t source, unsigned max_threads = 0);
     #pragma endregion Factories
 
     #pragma region Token access
-    Token &cur() const {
+    Token cur() const {
         return get_at(index);
     }
 
-    Token &peek(int offset) const {
+    Token peek(int offset) const {
         return get_at(index + offset);
     }
+
+    /// Cheaper than cur().get_type()
+    TokenType cur_type() const {
+        return tokens.get_type(clamp_index(index));
+    }
+
+    /// The current token's kind and subkind (see TokenBuffer::make_code())
+    TokenBuffer::code_t cur_code() const {
+        return tokens.get_code(clamp_index(index));
+    }
+
+    /// A token that has been read before (e.g. see _ExpectProxy::accept_at()). Must not be retired yet
+    Token token_at(state_t pos) const {
+        return get_at(pos);
+    }
     #pragma endregion Token access
 
     #pragma region End checking
     bool at_end() const {
-        return !tokens.empty() && tokens.back().is_endmarker();
+        return finished;
     }
 
     operator bool() const {
@@ -69,11 +115,13 @@ public:
     #pragma region Positioning
     void advance() {
         ++index;
+        furthest = std::max(furthest, index);
         ensure_total(index + 1);
     }
 
     void advance(size_t count) {
         index += count;
+        furthest = std::max(furthest, index);
         ensure_total(index + 1);
     }
 
@@ -81,26 +129,71 @@ public:
         return index;
     }
 
+    /// Seeking before the retire mark is allowed, but reading there isn't
     void seek(state_t pos) {
-        assert(pos <= tokens.size());
+        assert(pos <= retired + tokens.size());
 
         index = pos;
     }
+
+    /**
+     * The parser won't seek before pos anymore, so the tokens before it may be dropped.
+     *
+     * Only the tokens' memory is freed (and the input's, when streaming).
+     * Decoded values (identifiers, literals) handed out before stay valid,
+     * but when streaming, the source views of the retired tokens
+     * (Token::get_source) are invalidated along with the input. Raw tokens
+     * kept past this point (e.g. in a TokenStream node) must not have their
+     * source text accessed anymore.
+     */
+    void retire_before(state_t pos) {
+        assert(pos <= index);
+
+        ensure_total(pos + 1);
+        retire_mark = std::max(retire_mark, pos);
+
+        // The last token is always kept, so that there's something to clamp to
+        size_t count = std::min(retire_mark - retired, tokens.size() - 1);
+
+        if (count < min_retire_batch || count < tokens.size() / 2) {
+            return;
+        }
+
+        tokenizer.discard_before(tokens.get_location(count).file_pos);
+        tokens.discard_front(count);
+        retired += count;
+    }
+
+    /// The number of tokens dropped so far
+    size_t get_retired_count() const {
+        return retired;
+    }
+
+    /// Lexes the rest of the input now. Throws LexicalError like get_token()
+    void tokenize_all() {
+        while (!at_end()) {
+            pull_one();
+        }
+    }
     #pragma endregion Positioning
 
     #pragma region Debug
     std::ostream &dump(std::ostream &stream = std::cout) const {
         stream << "Lexer([";
 
+        if (retired > 0) {
+            stream << "... ";
+        }
+
         const size_t size = tokens.size();
         for (size_t i = 0; i < size; ++i) {
             if (i > 0) {
                 stream << " ";
             }
 
-            tokens[i].dump(stream);
+            tokens.get(i, get_scanner()).dump(stream);
 
-            if (i == index) {
+            if (retired + i == index) {
                 stream << " *";
             }
         }
@@ -128,64 +221,101 @@ public:
         _ExpectProxy &operator=(_ExpectProxy &&) = default;
 
         std::optional<Token> token(TokenType type) {
-            std::optional<Token> result = _token(type);
-
-            if (!result) {
-                return result;
+            if (!_is(type)) {
+                return std::nullopt;
             }
-            
-            lexer->advance();
 
-            return result;
+            return _take();
         }
 
         std::optional<Token> keyword(HardKeyword keyword) {
-            std::optional<Token> result = _token(TokenType::keyword);
-
-            if (!result || result->get_keyword().value != keyword) {
+            if (!_is_code(TokenBuffer::make_code(keyword))) {
                 return std::nullopt;
             }
 
-            lexer->advance();
-
-            return result;
+            return _take();
         }
 
         std::optional<Token> punct(Punct punct) {
-            std::optional<Token> result = _token(TokenType::punct);
+            if (!_is_code(TokenBuffer::make_code(punct))) {
+                return std::nullopt;
+            }
 
-            if (!result || result->get_punct().value != punct) {
+            return _take();
+        }
+
+        std::optional<Token> soft_keyword(const std::string_view &keyword) {
+            if (!_is(TokenType::name) || lexer->tokens.get_name(_cur_index()) != keyword) {
                 return std::nullopt;
             }
 
-            lexer->advance();
+            return _take();
+        }
 
-            return result;
+        #pragma region Non-materializing
+        /// Same as the above, but only says whether the token matched (and was consumed)
+        bool accept(TokenType type) {
+            return _skip_if(_is(type));
         }
 
-        std::optional<Token> soft_keyword(const std::string_view &keyword) {
-            std::optional<Token> result = _token(TokenType::name);
+        bool accept(HardKeyword keyword) {
+            return _skip_if(_is_code(TokenBuffer::make_code(keyword)));
+        }
+
+        bool accept(Punct punct) {
+            return _skip_if(_is_code(TokenBuffer::make_code(punct)));
+        }
+
+        bool accept_soft_keyword(std::string_view keyword) {
+            return _skip_if(_is(TokenType::name) && lexer->tokens.get_name(_cur_index()) == keyword);
+        }
+
+        /// Same as accept(), but returns the consumed token's state, so that it can be fetched later with token_at()
+        template <typename T>
+        std::optional<state_t> accept_at(T what) {
+            state_t state = lexer->tell();
 
-            if (!result || result->get_name().value != keyword) {
+            if (!accept(what)) {
                 return std::nullopt;
             }
 
-            lexer->advance();
-
-            return result;
+            return state;
         }
+        #pragma endregion Non-materializing
 
     protected:
         Lexer *lexer;
 
-        std::optional<Token> _token(TokenType type) {
+        size_t _cur_index() const {
+            return lexer->clamp_index(lexer->index);
+        }
+
+        bool _is(TokenType type) {
             lexer->ensure_next();
 
-            Token result = lexer->cur();
-            if (result.get_type() != type) {
-                return std::nullopt;
+            return lexer->tokens.get_type(_cur_index()) == type;
+        }
+
+        /// Checks the kind and the subkind at once
+        bool _is_code(TokenBuffer::code_t code) {
+            lexer->ensure_next();
+
+            return lexer->tokens.get_code(_cur_index()) == code;
+        }
+
+        bool _skip_if(bool matched) {
+            if (matched) {
+                lexer->advance();
             }
 
+            return matched;
+        }
+
+        Token _take() {
+            Token result = lexer->cur();
+
+            lexer->advance();
+
             return result;
         }
 
@@ -207,15 +337,16 @@ public:
             lexer->seek(state);
         }
 
-        #define WRAP_(NAME, ARG_TYPE) \
+        // The tokens are never needed here, so they aren't materialized
+        #define WRAP_(NAME, ARG_TYPE, IMPL) \
             bool NAME(ARG_TYPE arg) { \
-                return ((bool)_ExpectProxy::NAME(arg)) == positive; \
+                return _ExpectProxy::IMPL(arg) == positive; \
             }
 
-        WRAP_(token, TokenType);
-        WRAP_(keyword, HardKeyword);
-        WRAP_(punct, Punct);
-        WRAP_(soft_keyword, std::string_view);
+        WRAP_(token, TokenType, accept);
+        WRAP_(keyword, HardKeyword, accept);
+        WRAP_(punct, Punct, accept);
+        WRAP_(soft_keyword, std::string_view, accept_soft_keyword);
 
         #undef WRAP_
 
@@ -236,6 +367,7 @@ public:
      *  - `.expect().keyword(HardKeyword::if)`
      *  - `.expect().punct(Punct::semicolon)`
      *  - `.expect().soft_keyword("aboba")`
+     *  - `.expect().accept(Punct::semicolon)`, when a bool is enough
      */
     auto expect() {
         return _ExpectProxy{this};
@@ -267,6 +399,11 @@ public:
         return cur().get_location();
     }
 
+    /// The start of the furthest token the parser has advanced to, which is where syntax errors are reported
+    SrcLocation get_furthest_location() const {
+        return tokens.get_location(clamp_index(furthest));
+    }
+
     const Scanner &get_scanner() const {
         return tokenizer.get_scanner();
     }
@@ -275,10 +412,24 @@ public:
 protected:
     #pragma region Fields
     mutable Tokenizer tokenizer;
-    mutable std::vector<Token> tokens{};
+    mutable TokenBuffer tokens{};
+    /// Set once the endmarker is in tokens
+    mutable bool finished{false};
     size_t index{0};
+    size_t furthest{0};
+    /// The number of tokens dropped from the front of tokens, which is where state `retired` is now
+    size_t retired{0};
+    size_t retire_mark{0};
     #pragma endregion Fields
 
+    #pragma region Protected constructors
+    Lexer(Tokenizer tokenizer, TokenBuffer tokens) :
+        tokenizer{std::move(tokenizer)}, tokens{std::move(tokens)}, finished{true} {
+
+        assert(!this->tokens.empty() && this->tokens.get_type(this->tokens.size() - 1) == TokenType::endmarker);
+    }
+    #pragma endregion Protected constructors
+
     #pragma region Pulling
     // While this does resemble Scanner a lot, it actually operates by a bit different principle
     void pull_one() const {
@@ -286,7 +437,10 @@ protected:
             return;
         }
 
-        tokens.push_back(tokenizer.get_token());
+        Token token = tokenizer.get_token();
+
+        tokens.push(token);
+        finished = token.is_endmarker();
     }
 
     void ensure_next(size_t amount = 1) const {
@@ -294,21 +448,37 @@ protected:
     }
 
     void ensure_total(size_t amount) const {
-        while (amount > tokens.size() && !at_end()) {
+        while (amount > retired + tokens.size() && !at_end()) {
             pull_one();
         }
     }
     #pragma endregion Pulling
 
+    #pragma region Pretokenization
+    /**
+     * Picks up to count - 1 offsets to split text at, roughly evenly. Each is just
+     * past a newline that the tokenizer would see outside of any string or comment.
+     * The result is only a guess, though: pretokenize() verifies it.
+     */
+    static std::vector<size_t> find_chunk_boundaries(std::string_view text, size_t count);
+    #pragma endregion Pretokenization
+
     #pragma region Reading
-    Token &get_at(size_t pos) const {
+    /// The index in tokens of state pos. Past the end, the endmarker is repeated
+    size_t clamp_index(size_t pos) const {
+        assert(pos >= retired);
+
         ensure_total(pos + 1);
 
-        if (pos >= tokens.size()) {
-            return tokens.back();
+        if (pos - retired >= tokens.size()) {
+            return tokens.size() - 1;
         }
 
-        return tokens[pos];
+        return pos - retired;
+    }
+
+    Token get_at(size_t pos) const {
+        return tokens.get(clamp_index(pos), get_scanner());
     }
     #pragma endregion Reading
 
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/lex/src_location.hpp>
+
+#include <vector>
+#include <string_view>
+
+
+namespace bondrewd::lex {
+
+
+#pragma region LineIndex
+/**
+ * The offsets at which the lines of a file start, so that locations
+ * can be turned into lines and columns on demand.
+ *
+ * Built once per file, either in one go or chunk by chunk (for streams).
+ */
+class LineIndex {
+public:
+    #pragma region Constants and typedefs
+    using offset_t = SrcLocation::offset_t;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    LineIndex() = default;
+
+    explicit LineIndex(std::string_view text) {
+        extend(text);
+    }
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    LineIndex(const LineIndex &) = default;
+    LineIndex(LineIndex &&) = default;
+    LineIndex &operator=(const LineIndex &) = default;
+    LineIndex &operator=(LineIndex &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Building
+    /// Indexes the next chunk of the file, which must directly follow the previously indexed ones
+    void extend(std::string_view chunk);
+
+    size_t get_indexed_size() const noexcept {
+        return indexed_size;
+    }
+    #pragma endregion Building
+
+    #pragma region Queries
+    /// 0-based
+    unsigned get_line(offset_t file_pos) const;
+
+    offset_t get_line_start(unsigned line) const {
+        assert(line < line_starts.size());
+
+        return line_starts[line];
+    }
+
+    size_t get_line_count() const noexcept {
+        return line_starts.size();
+    }
+
+    /// The column at the end of line_prefix, which must start at a line start. Tabs are 4 wide, CRs are 0 wide
+    static unsigned measure_column(std::string_view line_prefix);
+    #pragma endregion Queries
+
+protected:
+    #pragma region Fields
+    std::vector<offset_t> line_starts{0};
+    size_t indexed_size{0};
+    #pragma endregion Fields
+
+};
+#pragma endregion LineIndex
+
+
+}  // namespace bondrewd::lex
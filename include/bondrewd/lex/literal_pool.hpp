@@ -0,0 +1,58 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/region.hpp>
+
+#include <string_view>
+#include <mutex>
+
+
+namespace bondrewd::lex {
+
+
+#pragma region LiteralPool
+/**
+ * Storage for the values of string literals that don't appear verbatim in the source.
+ *
+ * A literal without escapes is just a slice of its SourceBuffer, so only the
+ * decoded ones (and everything read from a stream, since its window moves on)
+ * are copied here. Each SourceBuffer owns a pool, so the values live exactly
+ * as long as the tokens' sources do.
+ *
+ * Thread-safe, since chunks of the same file may be tokenized in parallel.
+ */
+class LiteralPool {
+public:
+    #pragma region Constants and typedefs
+    static constexpr size_t default_chunk_size = 16 * 1024;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    LiteralPool() = default;
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    LiteralPool(const LiteralPool &) = delete;
+    LiteralPool(LiteralPool &&) = delete;
+    LiteralPool &operator=(const LiteralPool &) = delete;
+    LiteralPool &operator=(LiteralPool &&) = delete;
+    #pragma endregion Service constructors
+
+    #pragma region API
+    /// Copies value into the pool. The result is valid until the pool is destroyed
+    std::string_view store(std::string_view value);
+
+    size_t get_memory_usage() const;
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    mutable std::mutex mutex{};
+    util::Region region{default_chunk_size};
+    #pragma endregion Fields
+
+};
+#pragma endregion LiteralPool
+
+
+}  // namespace bondrewd::lex
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+
+#include <string_view>
+#include <optional>
+#include <cstdint>
+
+
+namespace bondrewd::lex::numbers {
+
+
+#pragma region Number parsing
+/**
+ * Conversion of numeric literals' digits into values.
+ *
+ * The digits are assumed to have been validated by the tokenizer already:
+ * no prefixes, signs or underscores, and only digits of the given base
+ * (2, 8, 10 or 16). There are no length limits, and floats are always
+ * correctly rounded (to nearest, ties to even).
+ */
+
+/// Empty if the value doesn't fit into 64 bits
+std::optional<uint64_t> parse_integer(std::string_view digits, unsigned base) noexcept;
+
+/// text is `digits[.digits][(e|E)[+|-]digits]`, with at least one digit before the exponent
+double parse_decimal_float(std::string_view text) noexcept;
+
+/**
+ * The value of `integral.fraction * base ** exponent`, for bases 2, 8 and 16.
+ *
+ * These are exact in binary, so no big number arithmetic is ever needed.
+ */
+double parse_binary_float(std::string_view integral, std::string_view fraction,
+                          int64_t exponent, unsigned base) noexcept;
+#pragma endregion Number parsing
+
+
+}  // namespace bondrewd::lex::numbers
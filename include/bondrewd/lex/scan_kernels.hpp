@@ -0,0 +1,56 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+
+#include <cstddef>
+
+
+namespace bondrewd::lex::kernels {
+
+
+#pragma region KernelSet
+/**
+ * Vectorized routines for the hot loops of the scanner.
+ *
+ * Every `skip_*` and `find_*` function takes a [begin, end) range and
+ * returns a pointer to the first byte that doesn't belong to the run
+ * (or end). They never read outside of the range.
+ *
+ * The best implementation supported by the CPU (AVX2, SSE2 or plain scalar)
+ * is selected once, at first use.
+ */
+struct KernelSet {
+    #pragma region Constants and typedefs
+    using find_fn = const char *(*)(const char *begin, const char *end);
+    using count_fn = size_t (*)(const char *begin, const char *end, char c);
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    const char *name;
+
+    /// ' ', '\t', '\n', '\v', '\f', '\r' (same as isspace in the C locale)
+    find_fn skip_space;
+    /// [A-Za-z0-9_]
+    find_fn skip_name;
+    /// Finds the next '\n'
+    find_fn find_newline;
+    /// Finds the next '*' or '/'
+    find_fn find_comment_delim;
+    /// Finds the next '\'', '"', '\\' or '\n'
+    find_fn find_string_delim;
+    /// Counts the occurences of c
+    count_fn count_byte;
+    #pragma endregion Fields
+};
+#pragma endregion KernelSet
+
+
+#pragma region Selection
+const KernelSet &get_kernels() noexcept;
+
+/// The portable implementation, mostly for testing and benchmarking
+const KernelSet &get_scalar_kernels() noexcept;
+#pragma endregion Selection
+
+
+}  // namespace bondrewd::lex::kernels
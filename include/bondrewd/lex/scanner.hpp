@@ -2,12 +2,18 @@
 
 #include <bondrewd/internal/common.hpp>
 #include <bondrewd/lex/src_location.hpp>
-
+#include <bondrewd/lex/line_index.hpp>
+#include <bondrewd/lex/source_buffer.hpp>
+#include <bondrewd/lex/source_manager.hpp>
+#include <bondrewd/lex/scan_kernels.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <iterator>
 #include <concepts>
-#include <vector>
 #include <iostream>
 #include <fstream>
 #include <filesystem>
@@ -17,19 +23,43 @@
 namespace bondrewd::lex {
 
 
+/**
+ * Character-level access to the source.
+ *
+ * A scanner either views a whole SourceBuffer, or streams from an std::istream.
+ * In the latter case only a window of the input is kept in memory: it is
+ * refilled in chunks as the scanner advances, and the bytes before it are
+ * retained only until discard_before() says no live token views them anymore.
+ * A streaming scanner can't go (or view) back past the start of the current
+ * token (see mark_token_start()).
+ */
 class Scanner {
 public:
     #pragma region Constants and typedefs
     static constexpr int end_of_file = EOF;
+
+    /// How much is read from a stream at once
+    static constexpr size_t default_chunk_size = 64 * 1024;
     #pragma endregion Constants and typedefs
 
     #pragma region Constructors
-    template <std::input_iterator I, std::sentinel_for<I> S>
-    Scanner(I src, S end, std::string_view filename = "") :
-        buf{std::move(src), std::move(end)}, loc{filename, 0, 0, 0} {
+    explicit Scanner(SourceBuffer::ptr_t source) :
+        source{std::move(source)}, buf{this->source->view()}, loc{this->source->location_at(0)} {
+
+        cached_char = get_at(loc.file_pos);
+    }
+
+    /// Streams from the input, which must outlive the scanner
+    Scanner(std::istream &input, std::string_view filename, size_t chunk_size = default_chunk_size) :
+        source{SourceManager::instance.add_streamed(std::string{filename})}, buf{}, loc{source->location_at(0)},
+        stream{&input}, chunk_size{std::max<size_t>(chunk_size, 1)} {
 
         cached_char = get_at(loc.file_pos);
     }
+
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    Scanner(I src, S end, std::string_view filename = "") :
+        Scanner{SourceBuffer::from_string(collect(std::move(src), std::move(end)), std::string{filename})} {}
     #pragma endregion Constructors
 
     #pragma region Service constructors
@@ -40,20 +70,18 @@ public:
     #pragma endregion Service constructors
 
     #pragma region Factories
+    /// Streams from the input, which must outlive the scanner
     static Scanner from_stream(std::istream &input, std::string_view filename = "") {
-        using iter = std::istream_iterator<char>;
-
-        return Scanner{iter{input}, iter{}, filename};
+        return Scanner{input, filename};
     }
 
     static Scanner from_string(std::string_view input, std::string_view filename = "") {
-        return Scanner{input.begin(), input.end(), filename};
+        return Scanner{SourceBuffer::from_string(std::string{input}, std::string{filename})};
     }
 
+    /// The file is memory-mapped, so tokens point straight into it
     static Scanner from_file(std::filesystem::path filename) {
-        std::ifstream stream{filename};
-
-        return from_stream(stream, filename.string());
+        return Scanner{SourceBuffer::from_file(filename)};
     }
     #pragma endregion Factories
 
@@ -97,42 +125,70 @@ public:
     }
 
     void skip_space() {
-        read_while<isspace>();
+        skip_run(kernels::get_kernels().skip_space);
+    }
+
+    /// [A-Za-z0-9_]*
+    std::string_view read_identifier() {
+        return read_run(kernels::get_kernels().skip_name);
     }
 
-    std::string_view skip_line() {
-        auto result = read_while<[](int c) { return c != '\n' && c != end_of_file; }>();
+    void skip_line() {
+        skip_run(kernels::get_kernels().find_newline);
         advance();
-        return result;
+    }
+
+    /// Skips to the next '*' or '/' (or the end of input)
+    void skip_to_comment_delim() {
+        skip_run(kernels::get_kernels().find_comment_delim);
+    }
+
+    /// Reads up to the next quote, backslash or newline (or the end of input)
+    std::string_view read_string_run() {
+        return read_run(kernels::get_kernels().find_string_delim);
     }
 
     std::string_view view_since(const SrcLocation &pos) const {
-        assert(pos.file_pos <= buf.size());
+        assert(base <= pos.file_pos);
         assert(pos.file_pos <= loc.file_pos);
 
-        return std::string_view(buf.begin() + pos.file_pos, buf.begin() + loc.file_pos);
+        return buf.substr(pos.file_pos - base, loc.file_pos - pos.file_pos);
     }
 
+    /// The input at [file_pos, file_pos + size). For streams, it's empty if that has been discarded already
+    std::string_view view_range(size_t file_pos, size_t size) const;
+
+    /// Note: for streams, the line is clipped to the current window
     std::string_view view_line(const SrcLocation &pos) const {
-        assert(pos.file_pos <= buf.size());
+        if (pos.file_pos < base) {
+            return {};
+        }
+
+        assert(pos.file_pos - base <= buf.size());
 
         constexpr auto is_newline = [](char c) { return c == '\n'; };
 
-        auto start = std::find_if(buf.rend() - pos.file_pos, buf.rend(), is_newline);
-        auto end = std::find_if(buf.begin() + pos.file_pos, buf.end(), is_newline);
+        auto start = std::find_if(buf.rend() - (pos.file_pos - base), buf.rend(), is_newline);
+        auto end = std::find_if(buf.begin() + (pos.file_pos - base), buf.end(), is_newline);
 
         return std::string_view(start.base(), end);
     }
 
+    /// Note: for streams, the context is clipped to the current window
     std::string_view view_context(const SrcLocation &pos, size_t context_size = 5) const {
-        assert(pos.file_pos <= buf.size());
+        if (pos.file_pos < base) {
+            return {};
+        }
+
+        assert(pos.file_pos - base <= buf.size());
 
         constexpr auto is_newline = [](char c) { return c == '\n'; };
 
-        auto point = buf.begin() + pos.file_pos;
+        size_t offset = pos.file_pos - base;
+        auto point = buf.begin() + offset;
 
-        auto start = std::max(point - context_size, buf.begin());
-        auto end = std::min(point + context_size, buf.end());
+        auto start = point - std::min(offset, context_size);
+        auto end = point + std::min(buf.size() - offset, context_size);
 
         if (auto start_nl = std::find_if(start, point, is_newline); start_nl != point) {
             start = start_nl + 1;
@@ -148,7 +204,11 @@ public:
 
     #pragma region Positioning
     void advance() {
-        loc.advance(cur());
+        if (at_eof()) {
+            return;
+        }
+
+        ++loc.file_pos;
         cached_char = get_at(loc.file_pos);
     }
 
@@ -158,18 +218,48 @@ public:
         }
     }
 
+    /// Same as advancing over every character of run, which must start at the current position
+    void advance_over(std::string_view run);
+
     SrcLocation tell() const {
         return loc;
     }
 
     void seek(const SrcLocation &pos) {
-        assert(pos.file_pos <= buf.size());
+        assert(base <= pos.file_pos && pos.file_pos - base <= buf.size());
 
         loc = pos;
         cached_char = get_at(loc.file_pos);
     }
     #pragma endregion Positioning
 
+    #pragma region Streaming
+    /**
+     * Streams keep everything from here on in the window, so that the token can be viewed as a whole.
+     *
+     * Whatever is skipped (see skip_space(), skip_line() and skip_to_comment_delim())
+     * isn't part of any token, so skipping moves the mark along.
+     */
+    void mark_token_start() {
+        mark = loc.file_pos;
+    }
+
+    /**
+     * Allows the scanner to free the input before the given position.
+     * Views into that part of the input (e.g. tokens' sources) are invalidated.
+     *
+     * Only has an effect when streaming, since SourceBuffers are kept whole.
+     */
+    void discard_before(size_t file_pos);
+
+    bool is_streaming() const {
+        return stream != nullptr;
+    }
+
+    /// The number of input bytes currently held in memory
+    size_t get_retained_size() const;
+    #pragma endregion Streaming
+
     #pragma region EOF checking
     bool at_eof() const {
         return cur() == end_of_file;
@@ -180,24 +270,118 @@ public:
     }
     #pragma endregion EOF checking
 
+    #pragma region Source access
+    const SourceBuffer::ptr_t &get_source() const {
+        return source;
+    }
+
+    /**
+     * Computes the line and column of a location in this scanner's input.
+     *
+     * Note: for streams, tabs and CRs are only accounted for in the current window
+     */
+    SrcPosition resolve(const SrcLocation &pos) const;
+    #pragma endregion Source access
+
 protected:
     #pragma region Fields
-    std::vector<char> buf{};
+    SourceBuffer::ptr_t source;
+    /// The (currently available) input, starting at file position `base`
+    mutable std::string_view buf;
+    mutable size_t base{0};
     SrcLocation loc;
     int cached_char{end_of_file};
     #pragma endregion Fields
 
+    #pragma region Streaming fields
+    struct Segment {
+        size_t base;
+        std::unique_ptr<std::string> data;
+    };
+
+    std::istream *stream{nullptr};
+    size_t chunk_size{default_chunk_size};
+    size_t mark{0};
+    mutable bool stream_done{false};
+    /// The last one is the current window
+    mutable std::deque<Segment> segments{};
+    /// Indexes everything read so far
+    mutable LineIndex stream_lines{};
+    #pragma endregion Streaming fields
+
     #pragma region Reading
     int get_at(size_t pos) const {
-        if (pos >= buf.size()) {
+        if (pos < base) {
             return end_of_file;
         }
 
-        return buf[pos];
+        if (pos - base >= buf.size() && !(stream && refill(pos))) {
+            return end_of_file;
+        }
+
+        return buf[pos - base];
     }
 
     auto get_cur_iter() const {
-        return buf.begin() + loc.file_pos;
+        return buf.begin() + (loc.file_pos - base);
+    }
+
+    /**
+     * Advances over the run found by kernel (see kernels::KernelSet),
+     * going on into the following chunks when streaming.
+     */
+    std::string_view read_run(kernels::KernelSet::find_fn kernel) {
+        auto start_pos = tell();
+
+        while (true) {
+            const char *begin = buf.data() + (loc.file_pos - base);
+            const char *end = buf.data() + buf.size();
+            const char *stop = kernel(begin, end);
+
+            advance_over(std::string_view(begin, stop - begin));
+
+            // advance_over has refilled the window already, if there's more input
+            if (stop != end || !stream || at_eof()) {
+                break;
+            }
+        }
+
+        return view_since(start_pos);
+    }
+
+    /**
+     * Same as read_run, but the run isn't viewed, so it needn't be kept in the window:
+     * the token mark follows the position. Meant for whitespace and comments,
+     * which may be arbitrarily long.
+     */
+    void skip_run(kernels::KernelSet::find_fn kernel) {
+        while (true) {
+            const char *begin = buf.data() + (loc.file_pos - base);
+            const char *end = buf.data() + buf.size();
+            const char *stop = kernel(begin, end);
+
+            // Moved ahead before advance_over refills, so that the run isn't carried over
+            mark = loc.file_pos + (size_t)(stop - begin);
+            advance_over(std::string_view(begin, stop - begin));
+
+            if (stop != end || !stream || at_eof()) {
+                break;
+            }
+        }
+    }
+
+    /// Reads chunks until pos is in the window. Returns false if the stream ends before that
+    bool refill(size_t pos) const;
+
+    template <std::input_iterator I, std::sentinel_for<I> S>
+    static std::string collect(I src, S end) {
+        std::string result{};
+
+        for (; src != end; ++src) {
+            result.push_back(*src);
+        }
+
+        return result;
     }
     #pragma endregion Reading
 
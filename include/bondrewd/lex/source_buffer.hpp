@@ -0,0 +1,158 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/mapped_file.hpp>
+#include <bondrewd/lex/src_location.hpp>
+#include <bondrewd/lex/line_index.hpp>
+#include <bondrewd/lex/literal_pool.hpp>
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+
+
+namespace bondrewd::lex {
+
+
+#pragma region SourceBuffer
+/**
+ * Immutable contents of a source file, along with its name.
+ *
+ * Files are memory-mapped when possible, so the scanner and the tokens
+ * view the mapping directly. Everything else is copied in once.
+ *
+ * Buffers are shared by reference (see ptr_t), and never move in memory,
+ * so string_views into them stay valid as long as any reference is alive.
+ *
+ * Buffers are created and owned by a SourceManager, which assigns their
+ * file ids. A buffer can resolve the SrcLocations in it to lines and columns.
+ * It also holds the decoded values of its string literals (see LiteralPool).
+ */
+class SourceBuffer {
+public:
+    #pragma region Constants and typedefs
+    using ptr_t = std::shared_ptr<const SourceBuffer>;
+    using file_id_t = SrcLocation::file_id_t;
+
+    /// Marks a placeholder for input that is scanned incrementally, and thus not retained
+    static constexpr struct streamed_t {} streamed{};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    /// Throws util::FileError if the contents are too large to be addressed by SrcLocation
+    SourceBuffer(file_id_t id, std::string name, util::MappedFile file) :
+        name{std::move(name)}, file{std::move(file)}, text{}, data{this->file.view()}, id{id} {
+
+        check_size();
+    }
+
+    /// Throws util::FileError if the contents are too large to be addressed by SrcLocation
+    SourceBuffer(file_id_t id, std::string name, std::string text) :
+        name{std::move(name)}, file{}, text{std::move(text)}, data{this->text}, id{id} {
+
+        check_size();
+    }
+
+    SourceBuffer(file_id_t id, std::string name, std::string text, streamed_t) :
+        SourceBuffer(id, std::move(name), std::move(text)) {
+
+        is_streamed_ = true;
+    }
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    SourceBuffer(const SourceBuffer &) = delete;
+    SourceBuffer(SourceBuffer &&) = delete;
+    SourceBuffer &operator=(const SourceBuffer &) = delete;
+    SourceBuffer &operator=(SourceBuffer &&) = delete;
+    #pragma endregion Service constructors
+
+    #pragma region Factories
+    // These register the buffer with SourceManager::instance
+
+    /// Throws util::FileError if the file can't be read
+    static ptr_t from_file(const std::filesystem::path &path);
+
+    static ptr_t from_string(std::string text, std::string name = "");
+
+    /// Reads the rest of the stream in bulk
+    static ptr_t from_stream(std::istream &input, std::string name = "");
+    #pragma endregion Factories
+
+    #pragma region API
+    std::string_view view() const noexcept {
+        return data;
+    }
+
+    size_t size() const noexcept {
+        return data.size();
+    }
+
+    std::string_view get_name() const noexcept {
+        return name;
+    }
+
+    bool is_mapped() const noexcept {
+        return file.is_mapped();
+    }
+
+    file_id_t get_id() const noexcept {
+        return id;
+    }
+
+    bool is_streamed() const noexcept {
+        return is_streamed_;
+    }
+
+    SrcLocation location_at(size_t file_pos) const noexcept {
+        assert(file_pos <= size() || is_streamed());
+
+        return SrcLocation{id, (SrcLocation::offset_t)file_pos};
+    }
+    #pragma endregion API
+
+    #pragma region Lines
+    /// Built on first use. Thread-safe
+    const LineIndex &get_line_index() const;
+
+    /// Only the filename is known for streamed buffers
+    SrcPosition resolve(const SrcLocation &loc) const;
+
+    /// The whole line containing loc, without the newline. Empty for streamed buffers
+    std::string_view view_line(const SrcLocation &loc) const;
+    #pragma endregion Lines
+
+    #pragma region Literals
+    /// Mutable even for const buffers, since tokenizing a file only adds to it
+    LiteralPool &get_literals() const noexcept {
+        return literals;
+    }
+    #pragma endregion Literals
+
+protected:
+    #pragma region Fields
+    std::string name;
+    util::MappedFile file;
+    std::string text;
+    std::string_view data;
+    file_id_t id;
+    bool is_streamed_{false};
+
+    mutable std::once_flag lines_built{};
+    mutable LineIndex lines{};
+
+    mutable LiteralPool literals{};
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    void check_size() const;
+    #pragma endregion Helpers
+
+};
+#pragma endregion SourceBuffer
+
+
+}  // namespace bondrewd::lex
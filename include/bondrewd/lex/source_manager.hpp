@@ -0,0 +1,154 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/lex/src_location.hpp>
+#include <bondrewd/lex/source_buffer.hpp>
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <shared_mutex>
+#include <filesystem>
+#include <iostream>
+
+
+namespace bondrewd::lex {
+
+
+#pragma region SourceManager
+/**
+ * Owns all loaded source buffers and assigns them file ids, so that any
+ * SrcLocation can be resolved without the scanner that produced it.
+ *
+ * Buffers stay loaded until they're unload()ed, so code that goes through
+ * many files should unload each of them once its locations no longer need
+ * resolving (see LoadedSource).
+ *
+ * The global instance is used by the SourceBuffer, Scanner, etc. factories,
+ * but you may create separate managers. File ids from different managers
+ * must not be mixed, though.
+ *
+ * All methods are thread-safe, so many files may be loaded and lexed at once.
+ */
+class SourceManager {
+public:
+    #pragma region Constants and typedefs
+    using file_id_t = SrcLocation::file_id_t;
+    #pragma endregion Constants and typedefs
+
+    #pragma region Instance
+    static SourceManager instance;
+    #pragma endregion Instance
+
+    #pragma region Constructors
+    SourceManager() {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    SourceManager(const SourceManager &) = delete;
+    SourceManager(SourceManager &&) = delete;
+    SourceManager &operator=(const SourceManager &) = delete;
+    SourceManager &operator=(SourceManager &&) = delete;
+    #pragma endregion Service constructors
+
+    #pragma region Loading
+    /// Memory-maps the file if possible. Throws util::FileError if it can't be read
+    SourceBuffer::ptr_t load_file(const std::filesystem::path &path);
+
+    SourceBuffer::ptr_t add_string(std::string text, std::string name = "");
+
+    /// Reads the rest of the stream in bulk
+    SourceBuffer::ptr_t add_stream(std::istream &input, std::string name = "");
+
+    /**
+     * Allocates a file id for an input that is scanned incrementally.
+     * Its text isn't retained, so only its name can be resolved
+     * from here (see Scanner::resolve for the rest).
+     */
+    SourceBuffer::ptr_t add_streamed(std::string name = "");
+
+    /// Releases the manager's reference to the buffer. The id isn't reused
+    void unload(file_id_t id);
+    #pragma endregion Loading
+
+    #pragma region Queries
+    /// Returns nullptr for unknown or unloaded ids
+    SourceBuffer::ptr_t get(file_id_t id) const;
+
+    /// Throws std::out_of_range for unknown or unloaded ids
+    SrcPosition resolve(const SrcLocation &loc) const;
+
+    /// The whole line containing loc, without the newline. Throws std::out_of_range like resolve()
+    std::string_view view_line(const SrcLocation &loc) const;
+
+    /// The number of ids allocated so far
+    size_t size() const;
+    #pragma endregion Queries
+
+protected:
+    #pragma region Fields
+    mutable std::shared_mutex mutex{};
+    /// Indexed by file id - 1
+    std::vector<SourceBuffer::ptr_t> buffers{};
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    template <typename ... As>
+    SourceBuffer::ptr_t add(As &&... args);
+
+    SourceBuffer::ptr_t get_checked(file_id_t id) const;
+    #pragma endregion Helpers
+
+};
+#pragma endregion SourceManager
+
+
+#pragma region LoadedSource
+/**
+ * Unloads a buffer from its manager when destroyed.
+ *
+ * Other references to the buffer (e.g. from Scanners) keep it alive
+ * as usual, but its id no longer resolves through the manager.
+ */
+class LoadedSource {
+public:
+    #pragma region Constructors
+    LoadedSource(SourceManager &manager, SourceBuffer::ptr_t buffer) :
+        manager{&manager}, buffer{std::move(buffer)} {}
+
+    ~LoadedSource() {
+        if (buffer) {
+            manager->unload(buffer->get_id());
+        }
+    }
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    LoadedSource(const LoadedSource &) = delete;
+    LoadedSource(LoadedSource &&other) noexcept :
+        manager{other.manager}, buffer{std::move(other.buffer)} {}
+    LoadedSource &operator=(const LoadedSource &) = delete;
+    LoadedSource &operator=(LoadedSource &&) = delete;
+    #pragma endregion Service constructors
+
+    #pragma region API
+    const SourceBuffer::ptr_t &get() const noexcept {
+        return buffer;
+    }
+
+    const SourceBuffer *operator->() const noexcept {
+        return buffer.get();
+    }
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    SourceManager *manager;
+    SourceBuffer::ptr_t buffer;
+    #pragma endregion Fields
+
+};
+#pragma endregion LoadedSource
+
+
+}  // namespace bondrewd::lex
@@ -4,73 +4,50 @@
 
 #include <string>
 #include <string_view>
+#include <limits>
+#include <cstdint>
 #include <fmt/core.h>
 
 
 namespace bondrewd::lex {
 
 
+/**
+ * A compact position in a source file: the file's id and a byte offset into it.
+ *
+ * Lines and columns aren't tracked while scanning. Instead, they're
+ * recovered on demand from the file's LineIndex (see SrcPosition).
+ */
 struct SrcLocation {
 public:
+    #pragma region Constants and typedefs
+    using file_id_t = uint32_t;
+    using offset_t = uint32_t;
+
+    /// Not assigned to any file
+    static constexpr file_id_t no_file = 0;
+    static constexpr size_t max_file_size = std::numeric_limits<offset_t>::max();
+    #pragma endregion Constants and typedefs
+
     #pragma region Fields
-    std::string_view filename{""};
-    size_t file_pos{0};
-    unsigned line{0};
-    unsigned column{0};
+    file_id_t file_id{no_file};
+    offset_t file_pos{0};
     #pragma endregion Fields
 
     #pragma region Constructors
-    SrcLocation() = default;
+    constexpr SrcLocation() = default;
 
-    SrcLocation(std::string_view filename, size_t file_pos, unsigned line, unsigned column) :
-        filename{filename}, file_pos{file_pos}, line{line}, column{column} {}
+    constexpr SrcLocation(file_id_t file_id, offset_t file_pos) :
+        file_id{file_id}, file_pos{file_pos} {}
     #pragma endregion Constructors
 
     #pragma region Service constructors
-    SrcLocation(const SrcLocation &) = default;
-    SrcLocation(SrcLocation &&) = default;
-    SrcLocation &operator=(const SrcLocation &) = default;
-    SrcLocation &operator=(SrcLocation &&) = default;
+    constexpr SrcLocation(const SrcLocation &) = default;
+    constexpr SrcLocation(SrcLocation &&) = default;
+    constexpr SrcLocation &operator=(const SrcLocation &) = default;
+    constexpr SrcLocation &operator=(SrcLocation &&) = default;
     #pragma endregion Service constructors
 
-    #pragma region to_string
-    std::string to_string(bool detailed = false) const {
-        if (filename.empty() || !detailed) {
-            return fmt::format("{}:{}", line, column);
-        }
-
-        return fmt::format("{}:{} in {}", filename, line, column);
-    }
-    #pragma endregion to_string
-
-    #pragma region Updating
-    void advance(int c) {
-        ++file_pos;
-
-        switch (c) {
-            case '\n':
-                ++line;
-                column = 0;
-                break;
-
-            case '\t':
-                column += 4;
-                break;
-
-            case '\r':
-                break;
-
-            case EOF:
-                --file_pos;
-                break;
-
-            default:
-                ++column;
-                break;
-        }
-    }
-    #pragma endregion Updating
-
     #pragma region Comparisons
     constexpr auto operator<=>(const SrcLocation& other) const {
         return file_pos <=> other.file_pos;
@@ -90,4 +67,33 @@ public:
 };
 
 
+static_assert(sizeof(SrcLocation) == 8);
+
+
+/**
+ * A human-readable SrcLocation, as resolved by a SourceBuffer or Scanner.
+ */
+struct SrcPosition {
+public:
+    #pragma region Fields
+    std::string_view filename{""};
+    /// 0-based
+    unsigned line{0};
+    /// 0-based. Tabs are 4 columns wide
+    unsigned column{0};
+    #pragma endregion Fields
+
+    #pragma region to_string
+    std::string to_string(bool detailed = false) const {
+        if (filename.empty() || !detailed) {
+            return fmt::format("{}:{}", line, column);
+        }
+
+        return fmt::format("{}:{} in {}", line, column, filename);
+    }
+    #pragma endregion to_string
+
+};
+
+
 }  // namespace bondrewd::lex
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/symbol.hpp>
 #include <bondrewd/lex/src_location.hpp>
 #include <bondrewd/lex/tokens.gen.hpp>
 
@@ -33,7 +34,7 @@ public:
         }
 
     TOKEN_FACTORY_(EndmarkerValue, endmarker, MACRO_PASS(), MACRO_PASS())
-    TOKEN_FACTORY_(NameValue, name, MACRO_PASS(std::string_view value,), MACRO_PASS(std::move(value)))
+    TOKEN_FACTORY_(NameValue, name, MACRO_PASS(util::Symbol value,), MACRO_PASS(value))
     TOKEN_FACTORY_(NumberValue, number, MACRO_PASS(int64_t value,), MACRO_PASS(value))
     TOKEN_FACTORY_(NumberValue, number, MACRO_PASS(double value,), MACRO_PASS(value))
     TOKEN_FACTORY_(StringValue, string, MACRO_PASS(std::string_view value, std::string_view quotes,), MACRO_PASS(std::move(value), std::move(quotes)))
@@ -55,7 +56,7 @@ protected:
     struct EndmarkerValue {};
 
     struct NameValue {
-        std::string_view value;
+        util::Symbol value;
     };
 
     struct NumberValue {
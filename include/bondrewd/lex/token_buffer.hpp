@@ -0,0 +1,192 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/symbol.hpp>
+#include <bondrewd/lex/src_location.hpp>
+#include <bondrewd/lex/scanner.hpp>
+#include <bondrewd/lex/token.hpp>
+
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+
+namespace bondrewd::lex {
+
+
+#pragma region TokenBuffer
+/**
+ * A struct-of-arrays store of tokens from a single file.
+ *
+ * Every token takes 14 bytes spread over parallel arrays (code, offset, length,
+ * payload index), so that the parser's constant backtracking over them
+ * touches as little memory as possible. The code packs the token's kind
+ * together with its subkind: the keyword or punct for those tokens, and
+ * whether a number is an integer. So matching a specific keyword or punct
+ * is a single 16-bit comparison (see make_code()). Names, numbers and
+ * strings keep their values in side tables, indexed by the payload.
+ *
+ * Full Tokens are only materialized on request.
+ */
+class TokenBuffer {
+public:
+    #pragma region Constants and typedefs
+    using offset_t = SrcLocation::offset_t;
+    using length_t = uint32_t;
+    using payload_t = uint32_t;
+    using subkind_t = uint16_t;
+    using code_t = uint16_t;
+
+    static constexpr payload_t no_payload = ~(payload_t)0;
+
+    /// The kind is kept in the code's upper bits, and the subkind in the rest
+    static constexpr unsigned subkind_bits = 12;
+    static constexpr code_t subkind_mask = ((code_t)1 << subkind_bits) - 1;
+
+    /// Number subkinds
+    enum class NumberKind : subkind_t {
+        integer,
+        floating,
+    };
+    #pragma endregion Constants and typedefs
+
+    #pragma region Token codes
+    static constexpr code_t make_code(TokenType type, subkind_t subkind = 0) {
+        assert(subkind <= subkind_mask);
+
+        return (code_t)(((code_t)type << subkind_bits) | subkind);
+    }
+
+    static constexpr code_t make_code(HardKeyword keyword) {
+        return make_code(TokenType::keyword, (subkind_t)keyword);
+    }
+
+    static constexpr code_t make_code(Punct punct) {
+        return make_code(TokenType::punct, (subkind_t)punct);
+    }
+    #pragma endregion Token codes
+
+    #pragma region Constructors
+    TokenBuffer() = default;
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    TokenBuffer(const TokenBuffer &) = delete;
+    TokenBuffer(TokenBuffer &&) = default;
+    TokenBuffer &operator=(const TokenBuffer &) = delete;
+    TokenBuffer &operator=(TokenBuffer &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Building
+    void push(const Token &token);
+
+    /// Moves other's tokens to the end of this one. Both must come from the same file
+    void append(TokenBuffer &&other);
+
+    void reserve(size_t count);
+
+    void clear();
+
+    /// Drops the first count tokens (and their payloads). The rest are shifted to the front
+    void discard_front(size_t count);
+    #pragma endregion Building
+
+    #pragma region Access
+    size_t size() const noexcept {
+        return codes.size();
+    }
+
+    bool empty() const noexcept {
+        return codes.empty();
+    }
+
+    code_t get_code(size_t idx) const {
+        assert(idx < size());
+
+        return codes[idx];
+    }
+
+    TokenType get_type(size_t idx) const {
+        return (TokenType)(get_code(idx) >> subkind_bits);
+    }
+
+    subkind_t get_subkind(size_t idx) const {
+        return get_code(idx) & subkind_mask;
+    }
+
+    HardKeyword get_keyword(size_t idx) const {
+        assert(get_type(idx) == TokenType::keyword);
+
+        return (HardKeyword)get_subkind(idx);
+    }
+
+    Punct get_punct(size_t idx) const {
+        assert(get_type(idx) == TokenType::punct);
+
+        return (Punct)get_subkind(idx);
+    }
+
+    util::Symbol get_name(size_t idx) const {
+        assert(get_type(idx) == TokenType::name);
+
+        return names[payloads[idx]];
+    }
+
+    SrcLocation get_location(size_t idx) const {
+        assert(idx < size());
+
+        return SrcLocation{file_id, offsets[idx]};
+    }
+
+    length_t get_length(size_t idx) const {
+        assert(idx < size());
+
+        return lengths[idx];
+    }
+
+    /// The source text is taken from the scanner that produced the tokens
+    Token get(size_t idx, const Scanner &scanner) const;
+    #pragma endregion Access
+
+    #pragma region Statistics
+    size_t get_memory_usage() const noexcept;
+    #pragma endregion Statistics
+
+protected:
+    #pragma region Fields
+    SrcLocation::file_id_t file_id{SrcLocation::no_file};
+
+    std::vector<code_t> codes{};
+    std::vector<offset_t> offsets{};
+    std::vector<length_t> lengths{};
+    std::vector<payload_t> payloads{};
+    #pragma endregion Fields
+
+    #pragma region Side tables
+    struct StringPayload {
+        std::string_view value;
+        std::string_view quotes;
+    };
+
+    std::vector<util::Symbol> names{};
+    std::vector<int64_t> integers{};
+    std::vector<double> floats{};
+    std::vector<StringPayload> strings{};
+    #pragma endregion Side tables
+
+    #pragma region Helpers
+    template <typename T>
+    static payload_t add_payload(std::vector<T> &table, T value) {
+        assert(table.size() < no_payload);
+
+        table.push_back(std::move(value));
+
+        return (payload_t)(table.size() - 1);
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion TokenBuffer
+
+
+}  // namespace bondrewd::lex
@@ -1,14 +1,16 @@
 #pragma once
 
 #include <bondrewd/internal/common.hpp>
+#include <bondrewd/internal/symbol.hpp>
 #include <bondrewd/lex/scanner.hpp>
 #include <bondrewd/lex/token.hpp>
 #include <bondrewd/lex/error.hpp>
+#include <bondrewd/lex/number_parsing.hpp>
 
 #include <cctype>
 #include <fmt/core.h>
 #include <ranges>
-#include <cmath>
+#include <limits>
 #include <cstdint>
 
 
@@ -18,8 +20,8 @@ namespace bondrewd::lex {
 class Tokenizer {
 public:
     #pragma region Constructors
-    Tokenizer(Scanner scanner) :
-        scanner{std::move(scanner)} {}
+    Tokenizer(Scanner scanner, util::SymbolTable &symbols = util::SymbolTable::instance) :
+        scanner{std::move(scanner)}, symbols{&symbols} {}
     #pragma endregion Constructors
 
     #pragma region Service constructors
@@ -41,6 +43,10 @@ public:
     static Tokenizer from_file(std::filesystem::path filename) {
         return Tokenizer{Scanner::from_file(filename)};
     }
+
+    static Tokenizer from_buffer(SourceBuffer::ptr_t source) {
+        return Tokenizer{Scanner{std::move(source)}};
+    }
     #pragma endregion Factories
 
     #pragma region Interface
@@ -56,17 +62,25 @@ public:
     const Scanner &get_scanner() const {
         return scanner;
     }
+
+    /// See Scanner::discard_before
+    void discard_before(size_t file_pos) {
+        scanner.discard_before(file_pos);
+    }
     #pragma endregion Interface
 
 protected:
     #pragma region Fields
     Scanner scanner;
+    /// Names are interned here
+    util::SymbolTable *symbols;
     Token token{Token::endmarker(SrcLocation{}, "")};
+    /// Scratch space for decoding string literals with escapes, and numbers with underscores
+    std::string literal_buffer{};
     #pragma endregion Fields
 
     #pragma region Private constants
     static const std::unordered_map<char, char> simple_escapes;
-    static constexpr unsigned MAX_NUMBER_LENGTH = 128;
     #pragma endregion Private constants
 
     #pragma region Character classification
@@ -130,14 +144,12 @@ protected:
     #pragma endregion Character classification
 
     #pragma region Number parsing
-    int64_t extract_integer(std::string_view digits, unsigned base, const SrcLocation &loc);
-
-    double extract_float(std::string_view integral_part,
-                         std::string_view fractional_part,
-                         std::string_view exponent_part,
-                         int exponent_sign,
-                         unsigned base,
-                         const SrcLocation &loc);
+    /**
+     * Checks that underscores only separate digits, and removes them.
+     *
+     * The result may be stored in literal_buffer, which must have room for the digits.
+     */
+    std::string_view strip_underscores(std::string_view digits, const SrcLocation &loc);
     #pragma endregion Number parsing
 
     #pragma region Tokenization subroutines
@@ -150,7 +162,12 @@ protected:
     /// Returns true if a token has been parsed, false if a comment has been consumed instead
     bool parse_other();
 
-    void parse_string(std::string_view start_quote);
+    /// token_start is at the opening quote, which has been consumed already
+    void parse_string(const SrcLocation &token_start, std::string_view start_quote);
+
+    /// Makes the token. Decoded values are taken from literal_buffer
+    void finish_string(const SrcLocation &token_start, std::string_view quotes,
+                       std::string_view contents, bool is_verbatim);
 
     void parse_line_comment();
 
@@ -1,4 +1,4 @@
-// AUTOGENERATED by bondrewd/tools/tokens/generate_tokens.py on 2023-06-07 19:23:03
+// AUTOGENERATED by bondrewd/tools/tokens/generate_tokens.py on 2026-10-17 08:32:59
 // DO NOT EDIT
 
 #pragma once
@@ -8,6 +8,8 @@
 
 #include <string_view>
 #include <cstdio>
+#include <cstdint>
+#include <optional>
 #include <unordered_map>
 
 
@@ -118,6 +120,103 @@ extern const std::unordered_map<std::string_view, Punct> string_to_punct;
 extern const std::unordered_map<std::string_view, HardKeyword> string_to_keyword;
 
 
+#pragma region Keyword lookup
+namespace _keyword_hash {
+
+
+inline constexpr uint8_t empty_slot = 0xFF;
+
+/// Indexed by HardKeyword
+inline constexpr std::string_view texts[] = {
+    "and",
+    "or",
+    "not",
+    "in",
+    "is",
+    "if",
+    "then",
+    "else",
+    "for",
+    "while",
+    "loop",
+    "return",
+    "break",
+    "continue",
+    "match",
+    "ctime",
+    "rtime",
+    "dyn",
+    "ref",
+    "move",
+    "copy",
+    "mut",
+    "var",
+    "let",
+    "func",
+    "class",
+    "struct",
+    "enum",
+    "trait",
+    "ns",
+    "impl",
+    "cartridge",
+    "expand",
+    "unwrap",
+    "import",
+    "export",
+    "public",
+    "protected",
+    "private",
+    "async",
+    "await",
+};
+
+inline constexpr uint8_t slots[128] = {
+    empty_slot, 40, 20, empty_slot, empty_slot, empty_slot, empty_slot, 36,
+    empty_slot, 29, 22, empty_slot, empty_slot, empty_slot, empty_slot, 35,
+    15, empty_slot, empty_slot, empty_slot, 7, empty_slot, 13, empty_slot,
+    31, empty_slot, empty_slot, 34, empty_slot, empty_slot, 23, empty_slot,
+    11, 21, 6, 12, 2, empty_slot, 37, empty_slot,
+    empty_slot, empty_slot, empty_slot, empty_slot, 19, empty_slot, empty_slot, empty_slot,
+    empty_slot, empty_slot, empty_slot, empty_slot, empty_slot, 5, empty_slot, empty_slot,
+    empty_slot, 26, 28, 38, 10, 16, empty_slot, empty_slot,
+    empty_slot, empty_slot, empty_slot, empty_slot, empty_slot, empty_slot, empty_slot, empty_slot,
+    empty_slot, empty_slot, empty_slot, empty_slot, 9, empty_slot, empty_slot, 30,
+    empty_slot, empty_slot, 18, empty_slot, empty_slot, empty_slot, empty_slot, empty_slot,
+    39, empty_slot, 8, 33, 27, empty_slot, empty_slot, empty_slot,
+    empty_slot, empty_slot, empty_slot, empty_slot, empty_slot, 24, empty_slot, empty_slot,
+    empty_slot, empty_slot, empty_slot, empty_slot, empty_slot, 0, 25, empty_slot,
+    17, empty_slot, empty_slot, 1, empty_slot, empty_slot, empty_slot, empty_slot,
+    empty_slot, 14, 4, empty_slot, empty_slot, 3, empty_slot, 32,
+};
+
+
+}  // namespace _keyword_hash
+
+
+/**
+ * Classifies a name as a hard keyword, using a generated perfect hash
+ * over its length, first and last characters.
+ */
+constexpr std::optional<HardKeyword> lookup_keyword(std::string_view text) noexcept {
+    if (text.size() < 2 || text.size() > 9) {
+        return std::nullopt;
+    }
+
+    const unsigned hash = ((unsigned)text.size() * 2 +
+                           (unsigned char)text.front() * 3 +
+                           (unsigned char)text.back() * 25) & 127;
+    const uint8_t index = _keyword_hash::slots[hash];
+
+    if (index == _keyword_hash::empty_slot || _keyword_hash::texts[index] != text) {
+        return std::nullopt;
+    }
+
+    return (HardKeyword)index;
+}
+#pragma endregion Keyword lookup
+
+
 
 class MiscTrie {
 public:
@@ -145,798 +244,325 @@ public:
     #pragma region Interface
     Verdict feed(Scanner &scanner, Punct *punct, std::string_view *quote) {
         auto start_pos = scanner.tell();
-    switch (scanner.cur()) {
-    case '/': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '/': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "//"
-
-                return Verdict::line_comment;
-            } break;
-            }
-        } break;
-        case '*': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "/*"
-
-                return Verdict::block_comment;
-            } break;
-            }
-        } break;
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "/="
-                if (punct) {
-                    *punct = Punct::SLASHEQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "/"
-            if (punct) {
-                *punct = Punct::SLASH;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '#': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "#"
-
-            return Verdict::line_comment;
-        } break;
-        }
-    } break;
-    case '(': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "("
-            if (punct) {
-                *punct = Punct::LPAR;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case ')': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // ")"
-            if (punct) {
-                *punct = Punct::RPAR;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '[': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "["
-            if (punct) {
-                *punct = Punct::LSQB;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case ']': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "]"
-            if (punct) {
-                *punct = Punct::RSQB;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '{': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "{"
-            if (punct) {
-                *punct = Punct::LBRACE;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '}': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "}"
-            if (punct) {
-                *punct = Punct::RBRACE;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '!': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "!="
-                if (punct) {
-                    *punct = Punct::NOTEQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "!"
-            if (punct) {
-                *punct = Punct::EXCLAMATION;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case ':': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case ':': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "::"
-                if (punct) {
-                    *punct = Punct::DOUBLECOLON;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // ":"
-            if (punct) {
-                *punct = Punct::COLON;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '.': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '.': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '.': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "..."
-                    if (punct) {
-                        *punct = Punct::ELLIPSIS;  // TODO
-                    }
-
-                    return Verdict::punct;
-                } break;
-                }
-            } break;
-            default: {
-                // "."
-                scanner.seek(start_pos);
-                scanner.advance(1);
-                if (punct) {
-                    *punct = Punct::DOT;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "."
-            if (punct) {
-                *punct = Punct::DOT;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case ',': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // ","
-            if (punct) {
-                *punct = Punct::COMMA;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case ';': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // ";"
-            if (punct) {
-                *punct = Punct::SEMI;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '+': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "+="
-                if (punct) {
-                    *punct = Punct::PLUSEQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "+"
-            if (punct) {
-                *punct = Punct::PLUS;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '-': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "-="
-                if (punct) {
-                    *punct = Punct::MINEQUAL;  // TODO
-                }
 
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        case '>': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "->"
-                if (punct) {
-                    *punct = Punct::RARROW;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "-"
-            if (punct) {
-                *punct = Punct::MINUS;  // TODO
-            }
+        state_t state = root_state;
+        state_t accepted = dead_state;
+        size_t length = 0;
+        size_t accepted_length = 0;
 
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '*': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '*': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "**"
-                if (punct) {
-                    *punct = Punct::POWER;  // TODO
-                }
+        while (scanner.cur() != Scanner::end_of_file) {
+            state = transitions[state][byte_classes[(unsigned char)scanner.cur()]];
 
-                return Verdict::punct;
-            } break;
+            if (state == dead_state) {
+                break;
             }
-        } break;
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "*="
-                if (punct) {
-                    *punct = Punct::STAREQUAL;  // TODO
-                }
 
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "*"
-            if (punct) {
-                *punct = Punct::STAR;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '%': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
             scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "%="
-                if (punct) {
-                    *punct = Punct::PERCENTEQUAL;  // TODO
-                }
+            ++length;
 
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "%"
-            if (punct) {
-                *punct = Punct::PERCENT;  // TODO
+            if (verdicts[state] != Verdict::none) {
+                accepted = state;
+                accepted_length = length;
             }
-
-            return Verdict::punct;
-        } break;
         }
-    } break;
-    case '~': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "~"
-            if (punct) {
-                *punct = Punct::TILDE;  // TODO
-            }
 
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '^': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "^="
-                if (punct) {
-                    *punct = Punct::CIRCUMFLEXEQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "^"
-            if (punct) {
-                *punct = Punct::CIRCUMFLEX;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '|': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "|="
-                if (punct) {
-                    *punct = Punct::VBAREQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "|"
-            if (punct) {
-                *punct = Punct::VBAR;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '&': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "&="
-                if (punct) {
-                    *punct = Punct::AMPEREQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "&"
-            if (punct) {
-                *punct = Punct::AMPER;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
+        if (accepted_length != length) {
+            // Back to the longest word seen
+            scanner.seek(start_pos);
+            scanner.advance(accepted_length);
         }
-    } break;
-    case '<': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '<': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '=': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "<<="
-                    if (punct) {
-                        *punct = Punct::LEFTSHIFTEQUAL;  // TODO
-                    }
-
-                    return Verdict::punct;
-                } break;
-                }
-            } break;
-            default: {
-                // "<<"
-                if (punct) {
-                    *punct = Punct::LEFTSHIFT;  // TODO
-                }
 
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '>': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "<=>"
-                    if (punct) {
-                        *punct = Punct::BIDIRCMP;  // TODO
-                    }
-
-                    return Verdict::punct;
-                } break;
-                }
-            } break;
-            default: {
-                // "<="
-                if (punct) {
-                    *punct = Punct::LESSEQUAL;  // TODO
-                }
+        const Verdict verdict = verdicts[accepted];
 
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "<"
+        switch (verdict) {
+        case Verdict::punct: {
             if (punct) {
-                *punct = Punct::LESS;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '>': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '>': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '=': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // ">>="
-                    if (punct) {
-                        *punct = Punct::RIGHTSHIFTEQUAL;  // TODO
-                    }
-
-                    return Verdict::punct;
-                } break;
-                }
-            } break;
-            default: {
-                // ">>"
-                if (punct) {
-                    *punct = Punct::RIGHTSHIFT;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // ">="
-                if (punct) {
-                    *punct = Punct::GREATEREQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
+                *punct = tags[accepted];
             }
         } break;
-        default: {
-            // ">"
-            if (punct) {
-                *punct = Punct::GREATER;  // TODO
+        case Verdict::string_quote: {
+            if (quote) {
+                *quote = words[accepted];
             }
-
-            return Verdict::punct;
         } break;
+        default:
+            break;
         }
-    } break;
-    case '=': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '=': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "=="
-                if (punct) {
-                    *punct = Punct::DOUBLEEQUAL;  // TODO
-                }
-
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        case '>': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "=>"
-                if (punct) {
-                    *punct = Punct::RARROW2;  // TODO
-                }
 
-                return Verdict::punct;
-            } break;
-            }
-        } break;
-        default: {
-            // "="
-            if (punct) {
-                *punct = Punct::EQUAL;  // TODO
-            }
-
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '@': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "@"
-            if (punct) {
-                *punct = Punct::AT;  // TODO
-            }
+        return verdict;
+    }
+    #pragma endregion Interface
 
-            return Verdict::punct;
-        } break;
-        }
-    } break;
-    case '\'': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '\'': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '\'': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "\'\'\'"
-                    if (quote) {
-                        *quote = "\'\'\'";
-                    }
-
-                    return Verdict::string_quote;
-                } break;
-                }
-            } break;
-            default: {
-                // "\'"
-                scanner.seek(start_pos);
-                scanner.advance(1);
-                if (quote) {
-                    *quote = "\'";
-                }
+protected:
+    #pragma region Tables
+    using state_t = uint8_t;
+
+    static constexpr state_t dead_state = 0;
+    static constexpr state_t root_state = 1;
+
+    static constexpr uint8_t byte_classes[256] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 16, 17, 18, 19, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 22, 23, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
 
-                return Verdict::string_quote;
-            } break;
-            }
-        } break;
-        default: {
-            // "\'"
-            if (quote) {
-                *quote = "\'";
-            }
+    static constexpr state_t transitions[58][28] = {
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 0: ""
+        {0, 10, 28, 3, 18, 22, 27, 4, 5, 17, 15, 13, 16, 12, 2, 11, 14, 23, 25, 24, 26, 6, 7, 20, 8, 21, 9, 19},  // 1: ""
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 29, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 2: "/"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 3: "#"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 4: "("
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 5: ")"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 6: "["
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 7: "]"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 8: "{"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 9: "}"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 10: "!"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 11: ":"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 12: "."
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 13: ","
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 14: ";"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 15: "+"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 0, 0, 0, 0, 0, 0, 0, 0},  // 16: "-"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 17: "*"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 18: "%"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 19: "~"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 20: "^"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 21: "|"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 22: "&"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 23: "<"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 46, 0, 0, 0, 0, 0, 0, 0, 0},  // 24: ">"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0},  // 25: "="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 26: "@"
+        {0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 27: "\'"
+        {0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 28: "\""
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 29: "//"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 30: "/*"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 31: "/="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 32: "!="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 33: "::"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 34: ".."
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 35: "+="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 36: "-="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 37: "->"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 38: "**"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 39: "*="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 40: "%="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 41: "^="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 42: "|="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 43: "&="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 44: "<<"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0},  // 45: "<="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 46: ">>"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 47: ">="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 48: "=="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 49: "=>"
+        {0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 50: "\'\'"
+        {0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 51: "\"\""
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 52: "..."
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 53: "<<="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 54: "<=>"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 55: ">>="
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 56: "\'\'\'"
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // 57: "\"\"\""
+    };
 
-            return Verdict::string_quote;
-        } break;
-        }
-    } break;
-    case '\"': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '\"': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '\"': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "\"\"\""
-                    if (quote) {
-                        *quote = "\"\"\"";
-                    }
-
-                    return Verdict::string_quote;
-                } break;
-                }
-            } break;
-            default: {
-                // "\""
-                scanner.seek(start_pos);
-                scanner.advance(1);
-                if (quote) {
-                    *quote = "\"";
-                }
+    static constexpr Verdict verdicts[58] = {
+        Verdict::none,
+        Verdict::none,
+        Verdict::punct,
+        Verdict::line_comment,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::string_quote,
+        Verdict::string_quote,
+        Verdict::line_comment,
+        Verdict::block_comment,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::none,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::none,
+        Verdict::none,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::punct,
+        Verdict::string_quote,
+        Verdict::string_quote,
+    };
 
-                return Verdict::string_quote;
-            } break;
-            }
-        } break;
-        default: {
-            // "\""
-            if (quote) {
-                *quote = "\"";
-            }
+    static constexpr std::string_view words[58] = {
+        "",
+        "",
+        "/",
+        "#",
+        "(",
+        ")",
+        "[",
+        "]",
+        "{",
+        "}",
+        "!",
+        ":",
+        ".",
+        ",",
+        ";",
+        "+",
+        "-",
+        "*",
+        "%",
+        "~",
+        "^",
+        "|",
+        "&",
+        "<",
+        ">",
+        "=",
+        "@",
+        "\'",
+        "\"",
+        "//",
+        "/*",
+        "/=",
+        "!=",
+        "::",
+        "..",
+        "+=",
+        "-=",
+        "->",
+        "**",
+        "*=",
+        "%=",
+        "^=",
+        "|=",
+        "&=",
+        "<<",
+        "<=",
+        ">>",
+        ">=",
+        "==",
+        "=>",
+        "\'\'",
+        "\"\"",
+        "...",
+        "<<=",
+        "<=>",
+        ">>=",
+        "\'\'\'",
+        "\"\"\"",
+    };
 
-            return Verdict::string_quote;
-        } break;
-        }
-    } break;
-    default: {
-        // ""
-        scanner.seek(start_pos);
-        scanner.advance(0);
-
-        return Verdict::none;
-    } break;
-    }
-    }
-    #pragma endregion Interface
+    static constexpr Punct tags[58] = {
+        Punct{},
+        Punct{},
+        Punct::SLASH,
+        Punct{},
+        Punct::LPAR,
+        Punct::RPAR,
+        Punct::LSQB,
+        Punct::RSQB,
+        Punct::LBRACE,
+        Punct::RBRACE,
+        Punct::EXCLAMATION,
+        Punct::COLON,
+        Punct::DOT,
+        Punct::COMMA,
+        Punct::SEMI,
+        Punct::PLUS,
+        Punct::MINUS,
+        Punct::STAR,
+        Punct::PERCENT,
+        Punct::TILDE,
+        Punct::CIRCUMFLEX,
+        Punct::VBAR,
+        Punct::AMPER,
+        Punct::LESS,
+        Punct::GREATER,
+        Punct::EQUAL,
+        Punct::AT,
+        Punct{},
+        Punct{},
+        Punct{},
+        Punct{},
+        Punct::SLASHEQUAL,
+        Punct::NOTEQUAL,
+        Punct::DOUBLECOLON,
+        Punct{},
+        Punct::PLUSEQUAL,
+        Punct::MINEQUAL,
+        Punct::RARROW,
+        Punct::POWER,
+        Punct::STAREQUAL,
+        Punct::PERCENTEQUAL,
+        Punct::CIRCUMFLEXEQUAL,
+        Punct::VBAREQUAL,
+        Punct::AMPEREQUAL,
+        Punct::LEFTSHIFT,
+        Punct::LESSEQUAL,
+        Punct::RIGHTSHIFT,
+        Punct::GREATEREQUAL,
+        Punct::DOUBLEEQUAL,
+        Punct::RARROW2,
+        Punct{},
+        Punct{},
+        Punct::ELLIPSIS,
+        Punct::LEFTSHIFTEQUAL,
+        Punct::BIDIRCMP,
+        Punct::RIGHTSHIFTEQUAL,
+        Punct{},
+        Punct{},
+    };
+    #pragma endregion Tables
 
 };
 
@@ -967,132 +593,122 @@ public:
     #pragma region Interface
     Verdict feed(Scanner &scanner, std::string_view *quote, int *escape) {
         auto start_pos = scanner.tell();
-    switch (scanner.cur()) {
-    case '\\': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "\\"
-                if (escape) {
-                    *escape = scanner.cur();
-                    scanner.advance();
-                }
 
-            return Verdict::escape;
-        } break;
-        }
-    } break;
-    case '\n': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        default: {
-            // "\n"
-
-            return Verdict::newline;
-        } break;
-        }
-    } break;
-    case '\'': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '\'': {
+        state_t state = root_state;
+        state_t accepted = dead_state;
+        size_t length = 0;
+        size_t accepted_length = 0;
+
+        while (scanner.cur() != Scanner::end_of_file) {
+            state = transitions[state][byte_classes[(unsigned char)scanner.cur()]];
+
+            if (state == dead_state) {
+                break;
+            }
+
             scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '\'': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "\'\'\'"
-                        if (quote) {
-                            *quote = "\'\'\'";
-                        }
-
-                    return Verdict::end_quote;
-                } break;
-                }
-            } break;
-            default: {
-                // "\'"
-                scanner.seek(start_pos);
-                scanner.advance(1);
-                    if (quote) {
-                        *quote = "\'";
-                    }
-
-                return Verdict::end_quote;
-            } break;
+            ++length;
+
+            if (verdicts[state] != Verdict::none) {
+                accepted = state;
+                accepted_length = length;
             }
-        } break;
-        default: {
-            // "\'"
-                if (quote) {
-                    *quote = "\'";
-                }
+        }
 
-            return Verdict::end_quote;
-        } break;
+        if (accepted_length != length) {
+            // Back to the longest word seen
+            scanner.seek(start_pos);
+            scanner.advance(accepted_length);
         }
-    } break;
-    case '\"': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '\"': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            case '\"': {
-                scanner.advance();
-                
-                switch (scanner.cur()) {
-                default: {
-                    // "\"\"\""
-                        if (quote) {
-                            *quote = "\"\"\"";
-                        }
-
-                    return Verdict::end_quote;
-                } break;
+
+        const Verdict verdict = verdicts[accepted];
+
+        switch (verdict) {
+        case Verdict::end_quote: {
+            if (quote) {
+                    *quote = words[accepted];
                 }
-            } break;
-            default: {
-                // "\""
-                scanner.seek(start_pos);
-                scanner.advance(1);
-                    if (quote) {
-                        *quote = "\"";
-                    }
-
-                return Verdict::end_quote;
-            } break;
-            }
         } break;
-        default: {
-            // "\""
-                if (quote) {
-                    *quote = "\"";
+        case Verdict::escape: {
+            if (escape) {
+                    *escape = scanner.cur();
+                    scanner.advance();
                 }
-
-            return Verdict::end_quote;
         } break;
+        default:
+            break;
         }
-    } break;
-    default: {
-        // ""
-        scanner.seek(start_pos);
-        scanner.advance(0);
-
-        return Verdict::none;
-    } break;
-    }
+
+        return verdict;
     }
     #pragma endregion Interface
 
+protected:
+    #pragma region Tables
+    using state_t = uint8_t;
+
+    static constexpr state_t dead_state = 0;
+    static constexpr state_t root_state = 1;
+
+    static constexpr uint8_t byte_classes[256] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr state_t transitions[10][5] = {
+        {0, 0, 0, 0, 0},  // 0: ""
+        {0, 3, 5, 4, 2},  // 1: ""
+        {0, 0, 0, 0, 0},  // 2: "\\"
+        {0, 0, 0, 0, 0},  // 3: "\n"
+        {0, 0, 0, 6, 0},  // 4: "\'"
+        {0, 0, 7, 0, 0},  // 5: "\""
+        {0, 0, 0, 8, 0},  // 6: "\'\'"
+        {0, 0, 9, 0, 0},  // 7: "\"\""
+        {0, 0, 0, 0, 0},  // 8: "\'\'\'"
+        {0, 0, 0, 0, 0},  // 9: "\"\"\""
+    };
+
+    static constexpr Verdict verdicts[10] = {
+        Verdict::none,
+        Verdict::none,
+        Verdict::escape,
+        Verdict::newline,
+        Verdict::end_quote,
+        Verdict::end_quote,
+        Verdict::none,
+        Verdict::none,
+        Verdict::end_quote,
+        Verdict::end_quote,
+    };
+
+    static constexpr std::string_view words[10] = {
+        "",
+        "",
+        "\\",
+        "\n",
+        "\'",
+        "\"",
+        "\'\'",
+        "\"\"",
+        "\'\'\'",
+        "\"\"\"",
+    };
+    #pragma endregion Tables
+
 };
 
 
@@ -1121,66 +737,99 @@ public:
     #pragma region Interface
     Verdict feed(Scanner &scanner) {
         auto start_pos = scanner.tell();
-    switch (scanner.cur()) {
-    case '/': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '*': {
-            scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "/*"
 
-                return Verdict::start;
-            } break;
+        state_t state = root_state;
+        state_t accepted = dead_state;
+        size_t length = 0;
+        size_t accepted_length = 0;
+
+        while (scanner.cur() != Scanner::end_of_file) {
+            state = transitions[state][byte_classes[(unsigned char)scanner.cur()]];
+
+            if (state == dead_state) {
+                break;
             }
-        } break;
-        default: {
-            // ""
-            scanner.seek(start_pos);
-            scanner.advance(0);
 
-            return Verdict::none;
-        } break;
-        }
-    } break;
-    case '*': {
-        scanner.advance();
-        
-        switch (scanner.cur()) {
-        case '/': {
             scanner.advance();
-            
-            switch (scanner.cur()) {
-            default: {
-                // "*/"
+            ++length;
 
-                return Verdict::end;
-            } break;
+            if (verdicts[state] != Verdict::none) {
+                accepted = state;
+                accepted_length = length;
             }
-        } break;
-        default: {
-            // ""
+        }
+
+        if (accepted_length != length) {
+            // Back to the longest word seen
             scanner.seek(start_pos);
-            scanner.advance(0);
+            scanner.advance(accepted_length);
+        }
 
-            return Verdict::none;
-        } break;
+        const Verdict verdict = verdicts[accepted];
+
+        switch (verdict) {
+        default:
+            break;
         }
-    } break;
-    default: {
-        // ""
-        scanner.seek(start_pos);
-        scanner.advance(0);
-
-        return Verdict::none;
-    } break;
-    }
+
+        return verdict;
     }
     #pragma endregion Interface
 
+protected:
+    #pragma region Tables
+    using state_t = uint8_t;
+
+    static constexpr state_t dead_state = 0;
+    static constexpr state_t root_state = 1;
+
+    static constexpr uint8_t byte_classes[256] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static constexpr state_t transitions[6][3] = {
+        {0, 0, 0},  // 0: ""
+        {0, 3, 2},  // 1: ""
+        {0, 4, 0},  // 2: "/"
+        {0, 0, 5},  // 3: "*"
+        {0, 0, 0},  // 4: "/*"
+        {0, 0, 0},  // 5: "*/"
+    };
+
+    static constexpr Verdict verdicts[6] = {
+        Verdict::none,
+        Verdict::none,
+        Verdict::none,
+        Verdict::none,
+        Verdict::start,
+        Verdict::end,
+    };
+
+    static constexpr std::string_view words[6] = {
+        "",
+        "",
+        "/",
+        "*",
+        "/*",
+        "*/",
+    };
+    #pragma endregion Tables
+
 };
 
 
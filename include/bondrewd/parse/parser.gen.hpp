@@ -1,14 +1,15 @@
-// AUTOGENERATED by bondrewd/tools/pegen++/pegenxx.py on 2023-06-07 19:23:02
+// AUTOGENERATED by bondrewd/tools/pegen++/pegenxx.py on 2026-10-17 10:27:39
 // DO NOT EDIT
 
 #pragma once
 
 #include <bondrewd/internal/common.hpp>
 #include <bondrewd/parse/parser_base.hpp>
+#include <bondrewd/parse/rule_profile.hpp>
 #include <bondrewd/ast/ast_nodes.gen.hpp>
 #include <bondrewd/lex/src_location.hpp>
 
-#include <map>
+#include <limits>
 #include <vector>
 #include <optional>
 #include <algorithm>
@@ -28,6 +29,11 @@ namespace bondrewd::parse {
 #pragma region Parser
 class Parser : public ParserBase<Parser> {
 public:
+    #pragma region Constants and typedefs
+    /// Changes whenever the grammar or its token listings do, e.g. for invalidating cached ASTs
+    static constexpr uint64_t grammar_hash = 0xe30069a0b411869d;
+    #pragma endregion Constants and typedefs
+
     #pragma region Constructors
     Parser(lex::Lexer lexer_) : ParserBase(std::move(lexer_)) {}
     #pragma endregion Constructors
@@ -46,13 +52,19 @@ public:
         if (!result) {
             auto &scanner = lexer.get_scanner();
 
-            lex::SrcLocation err_loc = scanner.tell();
+            lex::SrcLocation err_loc = lexer.get_furthest_location();
 
-            throw SyntaxError(fmt::format("Syntax error at {} (`{}`)", err_loc.to_string(), scanner.view_context(err_loc, 5)));
+            throw SyntaxError(fmt::format("Syntax error at {} (`{}`)", scanner.resolve(err_loc).to_string(), scanner.view_context(err_loc, 5)));
         }
 
         return *result;
     }
+
+    #if BONDREWD_PARSER_PROFILE
+    const RuleProfile &get_profile() const {
+        return _profile;
+    }
+    #endif
     #pragma endregion API
 
 protected:
@@ -191,6 +203,7 @@ protected:
         token_stream,
         token_stream_delim,
         token_stream_no_parens,
+        top_level_stmt,
         tuple_expr,
         type_annotation,
         unary_expr,
@@ -208,7 +221,7 @@ protected:
         std::tuple<
             ast::sequence<ast::expr>,
             ast::sequence<ast::expr>,
-            std::vector<std::string>,
+            std::vector<ast::identifier>,
             ast::sequence<ast::arg_spec>,
             ast::sequence<ast::stmt>,
             ast::sequence<ast::expr>,
@@ -218,12 +231,12 @@ protected:
             ast::sequence<ast::expr>,
             ast::sequence<ast::expr>,
             ast::sequence<ast::stmt>,
-            std::vector<std::string>,
+            std::vector<ast::identifier>,
             ast::sequence<ast::arg_spec>,
             ast::sequence<ast::arg_spec>,
             ast::sequence<ast::expr>,
             ast::sequence<ast::expr>,
-            std::vector<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>>,
+            std::vector<std::pair < ast::cmp_op , ast::field < ast::expr >>>,
             std::vector<lex::Token>,
             std::vector<lex::Token>,
             ast::field<ast::expr>,
@@ -251,7 +264,7 @@ protected:
             ast::field<ast::args_spec>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
-            ast::field<ast::assign_op>,
+            ast::assign_op,
             ast::field<ast::stmt>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
@@ -266,8 +279,8 @@ protected:
             ast::field<ast::stmt>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
-            std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>,
-            ast::field<ast::cmp_op>,
+            std::pair < ast::cmp_op , ast::field < ast::expr >>,
+            ast::cmp_op,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
             ast::field<ast::defn>,
@@ -300,7 +313,7 @@ protected:
             ast::field<ast::flow>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
-            std::string,
+            ast::identifier,
             ast::field<ast::expr>,
             ast::field<ast::defn>,
             ast::field<ast::defn>,
@@ -310,32 +323,33 @@ protected:
             ast::field<ast::stmt>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
-            ast::field<ast::binary_op>,
+            ast::binary_op,
             ast::field<ast::expr>,
             ast::field<ast::defn>,
             ast::field<ast::flow>,
             ast::field<ast::expr>,
-            ast::field<ast::binary_op>,
+            ast::binary_op,
             ast::field<ast::expr>,
             ast::field<ast::file>,
             ast::field<ast::stmt>,
             std::string,
             ast::field<ast::defn>,
             ast::field<ast::expr>,
-            ast::field<ast::binary_op>,
+            ast::binary_op,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
+            ast::field<ast::stmt>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
-            ast::field<ast::unary_op>,
+            ast::unary_op,
             ast::field<ast::defn>,
             ast::field<ast::expr>,
             ast::field<ast::expr>,
             ast::field<ast::flow>,
-            ast::field<ast::xtime_flag>
+            ast::xtime_flag
         >
     >;
 
@@ -343,6 +357,162 @@ protected:
     using rule_result_t = std::optional<rule_raw_result_t<R>>;
     #pragma endregion Rule types
 
+    #if BONDREWD_PARSER_PROFILE
+    #pragma region Profiling
+    static constexpr std::string_view RULE_NAMES[] = {
+        "_gather_29",
+        "_gather_31",
+        "_gather_5",
+        "_gather_8",
+        "_loop0_1",
+        "_loop0_24",
+        "_loop0_25",
+        "_loop0_26",
+        "_loop0_3",
+        "_loop0_30",
+        "_loop0_32",
+        "_loop0_33",
+        "_loop0_6",
+        "_loop0_7",
+        "_loop0_9",
+        "_loop1_14",
+        "_loop1_15",
+        "_loop1_16",
+        "_loop1_27",
+        "_loop1_28",
+        "_tmp_10",
+        "_tmp_11",
+        "_tmp_12",
+        "_tmp_13",
+        "_tmp_17",
+        "_tmp_18",
+        "_tmp_19",
+        "_tmp_2",
+        "_tmp_20",
+        "_tmp_21",
+        "_tmp_22",
+        "_tmp_23",
+        "_tmp_34",
+        "_tmp_35",
+        "_tmp_36",
+        "_tmp_37",
+        "_tmp_4",
+        "and_expr",
+        "any_paren",
+        "any_token",
+        "arg_spec",
+        "args_spec",
+        "args_spec_nonempty",
+        "arithm_expr",
+        "array_expr",
+        "assign_op",
+        "assign_stmt",
+        "attr_name",
+        "bidir_cmp_expr",
+        "bitand_expr",
+        "bitor_expr",
+        "bitwise_expr",
+        "bitxor_expr",
+        "block_expr",
+        "break_expr",
+        "call_args",
+        "call_expr",
+        "cartridge_header_stmt",
+        "colon_attr_expr",
+        "comparison_expr",
+        "comparison_followup_pair",
+        "comparison_op",
+        "continue_expr",
+        "ctime_block_expr",
+        "defn",
+        "defn_block",
+        "defn_expr",
+        "dot_attr_expr",
+        "expand_expr",
+        "expr",
+        "expr_0",
+        "expr_1",
+        "expr_2",
+        "expr_3",
+        "expr_4",
+        "expr_5",
+        "expr_6",
+        "expr_or_unit",
+        "expr_stmt",
+        "file",
+        "flow",
+        "flow_block",
+        "flow_control_expr",
+        "flow_expr",
+        "for_flow",
+        "func_body",
+        "func_def",
+        "group_expr",
+        "if_flow",
+        "impl_def",
+        "infix_call_expr",
+        "loop_flow",
+        "macro_call_expr",
+        "modulo_expr",
+        "name",
+        "not_expr",
+        "ns_def",
+        "ns_spec",
+        "ns_spec_raw",
+        "or_expr",
+        "pass_spec_expr",
+        "pass_stmt",
+        "power_expr",
+        "primary_expr",
+        "product_bin_op",
+        "product_expr",
+        "raw_defn",
+        "raw_flow",
+        "return_expr",
+        "shift_bin_op",
+        "shift_expr",
+        "start",
+        "stmt",
+        "strings",
+        "struct_def",
+        "subscript_expr",
+        "sum_bin_op",
+        "sum_expr",
+        "token_stream",
+        "token_stream_delim",
+        "token_stream_no_parens",
+        "top_level_stmt",
+        "tuple_expr",
+        "type_annotation",
+        "unary_expr",
+        "unary_op",
+        "var_def",
+        "var_ref_expr",
+        "weak_expr",
+        "while_flow",
+        "xtime_flag",
+    };
+
+    RuleProfile _profile{std::vector<std::string_view>(std::begin(RULE_NAMES), std::end(RULE_NAMES))};
+
+    /// Records a rule invocation when it goes out of scope
+    struct _ProfileGuard {
+        RuleProfile &profile;
+        RuleType rule_type;
+        state_t state;
+        uint64_t mark;
+
+        ~_ProfileGuard() {
+            profile.leave((unsigned)rule_type, state, mark);
+        }
+    };
+
+    _ProfileGuard _profile_rule(RuleType rule_type, state_t state) {
+        return _ProfileGuard{_profile, rule_type, state, _profile.enter()};
+    }
+    #pragma endregion Profiling
+    #endif
+
     #pragma region Helpers
     bool lookahead(bool positive, auto rule_func) {
         auto guard = lexer.lookahead(positive);
@@ -368,6 +538,20 @@ protected:
     void seek(state_t state) {
         lexer.seek(state);
     }
+
+    /**
+     * For grammar actions: promises that the parser won't seek back before the current
+     * position, so the tokens and the memoized results before it can be dropped.
+     *
+     * Only valid where no enclosing rule can backtrack past here, like after a top-level statement.
+     */
+    template <typename U>
+    U _commit(U result) {
+        lexer.retire_before(tell());
+        _prune_caches(tell());
+
+        return result;
+    }
     #pragma endregion Helpers
 
     #pragma region Extras
@@ -418,13 +602,14 @@ protected:
 
     #pragma region Caching
     #pragma region CacheNode
+    /// A memoized hit
     template <RuleType rule_type>
     class CacheNode {
     public:
-        rule_result_t<rule_type> value;
+        rule_raw_result_t<rule_type> value;
         state_t end_state;
 
-        CacheNode(rule_result_t<rule_type> value, state_t end_state)
+        CacheNode(rule_raw_result_t<rule_type> value, state_t end_state)
             : value{std::move(value)}, end_state{std::move(end_state)} {}
         
         CacheNode(const CacheNode &) = delete;
@@ -435,28 +620,88 @@ protected:
     };
     #pragma endregion CacheNode
 
+    #pragma region Memo table
+    /**
+     * The memo table has a row of MEMO_SLOTS entries (one per memoized rule) for every state,
+     * starting at _memo_base. An entry is MEMO_ABSENT, MEMO_FAILED, or MEMO_HIT plus
+     * the index of the hit in the rule's cache. So a lookup is a couple of loads.
+     *
+     * Failures always end where they start, so they need no CacheNode.
+     */
+    using memo_entry_t = uint32_t;
+
+    static constexpr memo_entry_t MEMO_ABSENT = 0;
+    static constexpr memo_entry_t MEMO_FAILED = 1;
+    static constexpr memo_entry_t MEMO_HIT = 2;
+
+    static constexpr unsigned MEMO_SLOTS = 16;
+
+    static constexpr unsigned _memo_slot(RuleType rule_type) {
+        switch (rule_type) {
+        case RuleType::bitand_expr:
+            return 0;
+        case RuleType::bitor_expr:
+            return 1;
+        case RuleType::bitxor_expr:
+            return 2;
+        case RuleType::block_expr:
+            return 3;
+        case RuleType::call_args:
+            return 4;
+        case RuleType::defn:
+            return 5;
+        case RuleType::expr:
+            return 6;
+        case RuleType::expr_0:
+            return 7;
+        case RuleType::expr_4:
+            return 8;
+        case RuleType::expr_5:
+            return 9;
+        case RuleType::flow:
+            return 10;
+        case RuleType::product_expr:
+            return 11;
+        case RuleType::shift_expr:
+            return 12;
+        case RuleType::stmt:
+            return 13;
+        case RuleType::strings:
+            return 14;
+        case RuleType::sum_expr:
+            return 15;
+
+        default:
+            return MEMO_SLOTS;
+        }
+    }
+    #pragma endregion Memo table
+
     #pragma region Fields
-    std::map<state_t, CacheNode<RuleType::bitand_expr>> cache_bitand_expr{};
-    std::map<state_t, CacheNode<RuleType::bitor_expr>> cache_bitor_expr{};
-    std::map<state_t, CacheNode<RuleType::bitxor_expr>> cache_bitxor_expr{};
-    std::map<state_t, CacheNode<RuleType::block_expr>> cache_block_expr{};
-    std::map<state_t, CacheNode<RuleType::call_args>> cache_call_args{};
-    std::map<state_t, CacheNode<RuleType::defn>> cache_defn{};
-    std::map<state_t, CacheNode<RuleType::expr>> cache_expr{};
-    std::map<state_t, CacheNode<RuleType::expr_0>> cache_expr_0{};
-    std::map<state_t, CacheNode<RuleType::expr_4>> cache_expr_4{};
-    std::map<state_t, CacheNode<RuleType::expr_5>> cache_expr_5{};
-    std::map<state_t, CacheNode<RuleType::flow>> cache_flow{};
-    std::map<state_t, CacheNode<RuleType::product_expr>> cache_product_expr{};
-    std::map<state_t, CacheNode<RuleType::shift_expr>> cache_shift_expr{};
-    std::map<state_t, CacheNode<RuleType::stmt>> cache_stmt{};
-    std::map<state_t, CacheNode<RuleType::strings>> cache_strings{};
-    std::map<state_t, CacheNode<RuleType::sum_expr>> cache_sum_expr{};
+    std::vector<memo_entry_t> _memo{};
+    state_t _memo_base = 0;
+
+    std::vector<CacheNode<RuleType::bitand_expr>> cache_bitand_expr{};
+    std::vector<CacheNode<RuleType::bitor_expr>> cache_bitor_expr{};
+    std::vector<CacheNode<RuleType::bitxor_expr>> cache_bitxor_expr{};
+    std::vector<CacheNode<RuleType::block_expr>> cache_block_expr{};
+    std::vector<CacheNode<RuleType::call_args>> cache_call_args{};
+    std::vector<CacheNode<RuleType::defn>> cache_defn{};
+    std::vector<CacheNode<RuleType::expr>> cache_expr{};
+    std::vector<CacheNode<RuleType::expr_0>> cache_expr_0{};
+    std::vector<CacheNode<RuleType::expr_4>> cache_expr_4{};
+    std::vector<CacheNode<RuleType::expr_5>> cache_expr_5{};
+    std::vector<CacheNode<RuleType::flow>> cache_flow{};
+    std::vector<CacheNode<RuleType::product_expr>> cache_product_expr{};
+    std::vector<CacheNode<RuleType::shift_expr>> cache_shift_expr{};
+    std::vector<CacheNode<RuleType::stmt>> cache_stmt{};
+    std::vector<CacheNode<RuleType::strings>> cache_strings{};
+    std::vector<CacheNode<RuleType::sum_expr>> cache_sum_expr{};
     
     #pragma endregion Fields
 
     template <RuleType rule_type>
-    constexpr std::map<state_t, CacheNode<rule_type>> &_get_cache() {
+    constexpr std::vector<CacheNode<rule_type>> &_get_cache() {
         if constexpr (rule_type == RuleType::bitand_expr) {
             return cache_bitand_expr;
         } else 
@@ -513,25 +758,114 @@ protected:
 
     template <RuleType rule_type>
     std::optional<rule_result_t<rule_type>> get_cached(state_t state) {
-        auto &cache = _get_cache<rule_type>();
+        constexpr unsigned slot = _memo_slot(rule_type);
+        static_assert(slot < MEMO_SLOTS, "Uncachable rule type");
 
-        auto it = cache.find(state);
+        // States before _memo_base wrap around, so they are out of range too
+        const size_t idx = (state - _memo_base) * MEMO_SLOTS + slot;
 
-        if (it == cache.end()) {
+        if (idx >= _memo.size() || _memo[idx] == MEMO_ABSENT) {
             return std::nullopt;
         }
 
-        seek(it->second.end_state);
+        if (_memo[idx] == MEMO_FAILED) {
+            seek(state);
+
+            return rule_result_t<rule_type>{};
+        }
 
-        return it->second.value;
+        const auto &node = _get_cache<rule_type>()[_memo[idx] - MEMO_HIT];
+
+        seek(node.end_state);
+
+        return rule_result_t<rule_type>{node.value};
     }
 
     /// Updates, if present
     template <RuleType rule_type>
-    void store_cached(state_t state, rule_result_t<rule_type> result) {
+    void store_cached(state_t state, const rule_result_t<rule_type> &result) {
+        constexpr unsigned slot = _memo_slot(rule_type);
+        static_assert(slot < MEMO_SLOTS, "Uncachable rule type");
+
+        if (state < _memo_base) {
+            return;
+        }
+
+        const size_t idx = (state - _memo_base) * MEMO_SLOTS + slot;
+
+        if (idx >= _memo.size()) {
+            _memo.resize((idx / MEMO_SLOTS + 1) * MEMO_SLOTS, MEMO_ABSENT);
+        }
+
+        if (!result) {
+            assert(tell() == state);
+
+            _memo[idx] = MEMO_FAILED;
+            return;
+        }
+
         auto &cache = _get_cache<rule_type>();
 
-        cache.insert_or_assign(state, CacheNode<rule_type>(std::move(result), tell()));
+        if (_memo[idx] >= MEMO_HIT) {
+            // Left-recursive rules grow their seeds in place
+            cache[_memo[idx] - MEMO_HIT] = CacheNode<rule_type>(*result, tell());
+            return;
+        }
+
+        assert(cache.size() < std::numeric_limits<memo_entry_t>::max() - MEMO_HIT);
+
+        _memo[idx] = MEMO_HIT + (memo_entry_t)cache.size();
+        cache.emplace_back(*result, tell());
+    }
+
+    /// Moves the hits still referenced by the memo table to the front of the cache
+    template <RuleType rule_type>
+    void _compact_cache() {
+        constexpr unsigned slot = _memo_slot(rule_type);
+
+        auto &cache = _get_cache<rule_type>();
+        std::vector<CacheNode<rule_type>> kept{};
+
+        for (size_t idx = slot; idx < _memo.size(); idx += MEMO_SLOTS) {
+            if (_memo[idx] >= MEMO_HIT) {
+                kept.push_back(std::move(cache[_memo[idx] - MEMO_HIT]));
+                _memo[idx] = MEMO_HIT + (memo_entry_t)(kept.size() - 1);
+            }
+        }
+
+        cache = std::move(kept);
+    }
+
+    /// Drops the results memoized before state. Done in batches, since the rest are moved
+    void _prune_caches(state_t state) {
+        if (state <= _memo_base) {
+            return;
+        }
+
+        const size_t rows = std::min(state - _memo_base, _memo.size() / MEMO_SLOTS);
+
+        if (rows < _memo.size() / MEMO_SLOTS / 2) {
+            return;
+        }
+
+        _memo.erase(_memo.begin(), _memo.begin() + rows * MEMO_SLOTS);
+        _memo_base += rows;
+        _compact_cache<RuleType::bitand_expr>();
+        _compact_cache<RuleType::bitor_expr>();
+        _compact_cache<RuleType::bitxor_expr>();
+        _compact_cache<RuleType::block_expr>();
+        _compact_cache<RuleType::call_args>();
+        _compact_cache<RuleType::defn>();
+        _compact_cache<RuleType::expr>();
+        _compact_cache<RuleType::expr_0>();
+        _compact_cache<RuleType::expr_4>();
+        _compact_cache<RuleType::expr_5>();
+        _compact_cache<RuleType::flow>();
+        _compact_cache<RuleType::product_expr>();
+        _compact_cache<RuleType::shift_expr>();
+        _compact_cache<RuleType::stmt>();
+        _compact_cache<RuleType::strings>();
+        _compact_cache<RuleType::sum_expr>();
     }
     #pragma endregion Caching
 
@@ -540,9 +874,12 @@ protected:
     // start: file
     std::optional<ast::field<ast::file>> parse_start_rule();
 
-    // file: stmt* $
+    // file: top_level_stmt* $
     std::optional<ast::field<ast::file>> parse_file_rule();
 
+    // top_level_stmt: stmt
+    std::optional<ast::field<ast::stmt>> parse_top_level_stmt_rule();
+
     // stmt: cartridge_header_stmt | assign_stmt | expr_stmt | pass_stmt
     std::optional<ast::field<ast::stmt>> parse_stmt_rule();
 
@@ -553,7 +890,7 @@ protected:
     std::optional<ast::field<ast::stmt>> parse_assign_stmt_rule();
 
     // assign_op: '=' | '+=' | '-=' | '*=' | '/=' | '%=' | '<<=' | '>>=' | '&=' | '|=' | '^='
-    std::optional<ast::field<ast::assign_op>> parse_assign_op_rule();
+    std::optional<ast::assign_op> parse_assign_op_rule();
 
     // expr_stmt: expr ';'
     std::optional<ast::field<ast::stmt>> parse_expr_stmt_rule();
@@ -676,10 +1013,10 @@ protected:
     std::optional<ast::field<ast::expr>> parse_comparison_expr_rule();
 
     // comparison_followup_pair: comparison_op expr_3
-    std::optional<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>> parse_comparison_followup_pair_rule();
+    std::optional<std::pair < ast::cmp_op , ast::field < ast::expr >>> parse_comparison_followup_pair_rule();
 
     // comparison_op: '==' | '!=' | '<' | '<=' | '>' | '>=' | 'in' | 'not' 'in'
-    std::optional<ast::field<ast::cmp_op>> parse_comparison_op_rule();
+    std::optional<ast::cmp_op> parse_comparison_op_rule();
 
     // bidir_cmp_expr: expr_3 '<=>' expr_3
     std::optional<ast::field<ast::expr>> parse_bidir_cmp_expr_rule();
@@ -696,7 +1033,7 @@ protected:
     std::optional<ast::field<ast::expr>> parse_raw_sum_expr();
 
     // sum_bin_op: '+' | '-'
-    std::optional<ast::field<ast::binary_op>> parse_sum_bin_op_rule();
+    std::optional<ast::binary_op> parse_sum_bin_op_rule();
 
     // Left-recursive
     // product_expr: (product_expr | expr_4) product_bin_op expr_4
@@ -704,7 +1041,7 @@ protected:
     std::optional<ast::field<ast::expr>> parse_raw_product_expr();
 
     // product_bin_op: '*' | '/'
-    std::optional<ast::field<ast::binary_op>> parse_product_bin_op_rule();
+    std::optional<ast::binary_op> parse_product_bin_op_rule();
 
     // modulo_expr: expr_4 '%' expr_4
     std::optional<ast::field<ast::expr>> parse_modulo_expr_rule();
@@ -733,7 +1070,7 @@ protected:
     std::optional<ast::field<ast::expr>> parse_raw_shift_expr();
 
     // shift_bin_op: '<<' | '>>'
-    std::optional<ast::field<ast::binary_op>> parse_shift_bin_op_rule();
+    std::optional<ast::binary_op> parse_shift_bin_op_rule();
 
     // expr_4: unary_expr | power_expr | expr_5
     std::optional<ast::field<ast::expr>> parse_expr_4_rule();
@@ -742,7 +1079,7 @@ protected:
     std::optional<ast::field<ast::expr>> parse_unary_expr_rule();
 
     // unary_op: '+' | '-' | '~' | '&' | '*'
-    std::optional<ast::field<ast::unary_op>> parse_unary_op_rule();
+    std::optional<ast::unary_op> parse_unary_op_rule();
 
     // power_expr: expr_5 '**' expr_5
     std::optional<ast::field<ast::expr>> parse_power_expr_rule();
@@ -845,15 +1182,15 @@ protected:
     std::optional<ast::field<ast::expr>> parse_infix_call_expr_rule();
 
     // name: NAME
-    std::optional<std::string> parse_name_rule();
+    std::optional<ast::identifier> parse_name_rule();
 
     // xtime_flag: 'ctime' | 'rtime' | 
-    std::optional<ast::field<ast::xtime_flag>> parse_xtime_flag_rule();
+    std::optional<ast::xtime_flag> parse_xtime_flag_rule();
 
     // type_annotation: ':' expr
     std::optional<ast::field<ast::expr>> parse_type_annotation_rule();
 
-    // _loop0_1: stmt
+    // _loop0_1: top_level_stmt
     std::optional<ast::sequence<ast::stmt>> parse__loop0_1_rule();
 
     // _tmp_2: '=' expr
@@ -866,10 +1203,10 @@ protected:
     std::optional<std::monostate> parse__tmp_4_rule();
 
     // _loop0_6: '::' name
-    std::optional<std::vector<std::string>> parse__loop0_6_rule();
+    std::optional<std::vector<ast::identifier>> parse__loop0_6_rule();
 
     // _gather_5: name _loop0_6
-    std::optional<std::vector<std::string>> parse__gather_5_rule();
+    std::optional<std::vector<ast::identifier>> parse__gather_5_rule();
 
     // _loop0_7: (',' arg_spec)
     std::optional<ast::sequence<ast::arg_spec>> parse__loop0_7_rule();
@@ -899,7 +1236,7 @@ protected:
     std::optional<ast::sequence<ast::expr>> parse__loop1_15_rule();
 
     // _loop1_16: comparison_followup_pair
-    std::optional<std::vector<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>>> parse__loop1_16_rule();
+    std::optional<std::vector<std::pair < ast::cmp_op , ast::field < ast::expr >>>> parse__loop1_16_rule();
 
     // _tmp_17: sum_expr | product_expr
     std::optional<ast::field<ast::expr>> parse__tmp_17_rule();
@@ -42,6 +42,15 @@ public:
     static T from_file(std::filesystem::path filename) {
         return T{lex::Lexer::from_file(filename)};
     }
+
+    static T from_buffer(lex::SourceBuffer::ptr_t source) {
+        return T{lex::Lexer::from_buffer(std::move(source))};
+    }
+
+    /// See Lexer::pretokenize
+    static T from_buffer_pretokenized(lex::SourceBuffer::ptr_t source, unsigned max_threads = 0) {
+        return T{lex::Lexer::pretokenize(std::move(source), max_threads)};
+    }
     #pragma endregion Factories
 
 protected:
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+
+#include <vector>
+#include <string_view>
+#include <unordered_map>
+#include <iostream>
+#include <cstdint>
+
+
+#ifndef BONDREWD_PARSER_PROFILE
+#define BONDREWD_PARSER_PROFILE 0
+#endif
+
+
+namespace bondrewd::parse {
+
+
+#pragma region RuleProfile
+/**
+ * Per-rule statistics on how much re-parsing memoization saves.
+ *
+ * Only filled in by parsers built with BONDREWD_PARSER_PROFILE. The work of
+ * a rule invocation is the number of rule invocations it takes, itself included.
+ * When a rule is invoked again at a position it's been invoked at before, the
+ * work of the first invocation there counts as repeated, whether this build
+ * memoizes the rule or not. That is exactly what memoizing it saves.
+ *
+ * The dump is what pegenxx.py's --memo-profile option reads.
+ */
+class RuleProfile {
+public:
+    #pragma region Constants and typedefs
+    using state_t = size_t;
+
+    struct RuleStats {
+        uint64_t calls{0};
+        /// The number of distinct positions, i.e. the memo entries the rule would need
+        uint64_t positions{0};
+        uint64_t repeats{0};
+        uint64_t work{0};
+        uint64_t repeated_work{0};
+    };
+    #pragma endregion Constants and typedefs
+
+    #pragma region Constructors
+    explicit RuleProfile(std::vector<std::string_view> rule_names) :
+        rule_names{std::move(rule_names)}, stats(this->rule_names.size()), first_work(this->rule_names.size()) {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    RuleProfile(const RuleProfile &) = delete;
+    RuleProfile(RuleProfile &&) = default;
+    RuleProfile &operator=(const RuleProfile &) = delete;
+    RuleProfile &operator=(RuleProfile &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Recording
+    /// Returns the mark to pass to leave()
+    uint64_t enter() noexcept {
+        return invocations++;
+    }
+
+    void leave(unsigned rule, state_t state, uint64_t mark);
+    #pragma endregion Recording
+
+    #pragma region Access
+    const RuleStats &get_stats(unsigned rule) const {
+        assert(rule < stats.size());
+
+        return stats[rule];
+    }
+
+    uint64_t get_invocations() const noexcept {
+        return invocations;
+    }
+    #pragma endregion Access
+
+    #pragma region Debug
+    /// One line per invoked rule: `name calls positions repeats work repeated_work`
+    std::ostream &dump(std::ostream &stream = std::cout) const;
+    #pragma endregion Debug
+
+protected:
+    #pragma region Fields
+    std::vector<std::string_view> rule_names;
+    std::vector<RuleStats> stats;
+    /// The work of the first invocation at each position, per rule
+    std::vector<std::unordered_map<state_t, uint64_t>> first_work;
+    uint64_t invocations{0};
+    #pragma endregion Fields
+
+};
+#pragma endregion RuleProfile
+
+
+}  // namespace bondrewd::parse
@@ -5,7 +5,30 @@ namespace bondrewd::ast {
 
 
 #pragma region Arena
-util::Arena ast_arena{};
+thread_local util::Arena ast_arena{};
+
+namespace {
+
+thread_local util::Arena *active_ast_arena = nullptr;
+
+}  // namespace
+
+
+util::Arena &current_ast_arena() noexcept {
+    return active_ast_arena ? *active_ast_arena : ast_arena;
+}
+
+
+ASTArenaScope::ASTArenaScope(util::Arena &arena) :
+    prev{active_ast_arena} {
+
+    active_ast_arena = &arena;
+}
+
+
+ASTArenaScope::~ASTArenaScope() {
+    active_ast_arena = prev;
+}
 #pragma endregion Arena
 
 
@@ -0,0 +1,293 @@
+#include <bondrewd/ast/flat_cache.hpp>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <fmt/core.h>
+
+
+namespace bondrewd::ast::flat {
+
+
+#pragma region Helpers
+namespace {
+
+
+using cache_format::FileHeader;
+using cache_format::Section;
+using cache_format::IdentifierEntry;
+
+
+/// The expected (size, alignment) of every section's elements, in section order
+constexpr auto expected_layout() {
+    std::array<std::pair<uint32_t, uint32_t>, cache_format::section_count> result{};
+    size_t idx = 0;
+
+    auto add = [&]<typename T>(std::type_identity<T>) {
+        result[idx++] = {(uint32_t)sizeof(T), (uint32_t)alignof(T)};
+    };
+
+    [&]<typename ... Ts>(std::type_identity<std::tuple<std::vector<Ts>...>>) {
+        (add(std::type_identity<Ts>{}), ...);
+    }(std::type_identity<Tree::rows_t>{});
+
+    [&]<typename ... Ts>(std::type_identity<std::tuple<std::vector<Ts>...>>) {
+        (add(std::type_identity<Ts>{}), ...);
+    }(std::type_identity<Tree::pools_t>{});
+
+    add(std::type_identity<IdentifierEntry>{});
+    add(std::type_identity<char>{});
+
+    return result;
+}
+
+
+class CacheWriter {
+public:
+    CacheWriter() {
+        data.resize(sizeof(FileHeader) + sizeof(Section) * cache_format::section_count);
+    }
+
+    template <typename T>
+    void add_section(std::span<const T> items) {
+        Section section{0, items.size(), (uint32_t)sizeof(T), (uint32_t)alignof(T)};
+
+        if constexpr (!cacheable<T>) {
+            if (!items.empty()) {
+                throw CacheError(fmt::format("Trees with {} can't be cached", typeid(T).name()));
+            }
+        } else {
+            data.resize((data.size() + cache_format::section_alignment - 1) / cache_format::section_alignment
+                        * cache_format::section_alignment);
+
+            section.offset = data.size();
+            data.append((const char *)items.data(), items.size_bytes());
+        }
+
+        sections.push_back(section);
+    }
+
+    std::string finish(const FileHeader &header) {
+        assert(sections.size() == cache_format::section_count);
+
+        std::memcpy(data.data(), &header, sizeof(header));
+        std::memcpy(data.data() + sizeof(header), sections.data(), sizeof(Section) * sections.size());
+
+        return std::move(data);
+    }
+
+protected:
+    std::string data{};
+    std::vector<Section> sections{};
+
+};
+
+
+}  // namespace
+#pragma endregion Helpers
+
+
+uint64_t hash_source(std::string_view source) noexcept {
+    uint64_t result = 0xcbf29ce484222325ull;
+
+    for (char c : source) {
+        result ^= (uint8_t)c;
+        result *= 0x100000001b3ull;
+    }
+
+    return result;
+}
+
+
+#pragma region save_cache
+void save_cache(const Tree &tree, uint64_t grammar_hash, uint64_t source_hash, const std::filesystem::path &path) {
+    CacheWriter writer{};
+
+    auto add_all = [&](const auto &... arrays) {
+        (writer.add_section(std::span{arrays}), ...);
+    };
+
+    std::apply(add_all, tree.get_all_rows());
+    std::apply(add_all, tree.get_all_pools());
+
+    std::vector<IdentifierEntry> entries{};
+    std::string text{};
+
+    entries.reserve(tree.get_identifiers().size());
+    for (const auto &name : tree.get_identifiers()) {
+        entries.push_back(IdentifierEntry{(uint32_t)text.size(), (uint32_t)name.str().size()});
+        text += name.str();
+    }
+
+    writer.add_section(std::span<const IdentifierEntry>{entries});
+    writer.add_section(std::span<const char>{text});
+
+    FileHeader header{};
+    std::memcpy(header.magic, cache_format::magic, sizeof(header.magic));
+    header.version = cache_format::version;
+    header.section_count = cache_format::section_count;
+    header.schema_hash = Tree::schema_hash;
+    header.grammar_hash = grammar_hash;
+    header.source_hash = source_hash;
+    header.root = tree.root.bits;
+
+    std::string data = writer.finish(header);
+
+    // Written to a temporary file first, so that readers never see a partial cache
+    std::filesystem::path tmp_path = path;
+    tmp_path += ".tmp";
+
+    {
+        std::ofstream stream{tmp_path, std::ios::binary | std::ios::trunc};
+        if (!stream.write(data.data(), (std::streamsize)data.size())) {
+            throw CacheError(fmt::format("Failed to write {}", tmp_path.string()));
+        }
+    }
+
+    std::error_code error{};
+    std::filesystem::rename(tmp_path, path, error);
+    if (error) {
+        throw CacheError(fmt::format("Failed to write {}: {}", path.string(), error.message()));
+    }
+}
+#pragma endregion save_cache
+
+
+#pragma region MappedTree
+MappedTree::MappedTree(util::MappedFile file, util::SymbolTable &symbols) :
+    file{std::move(file)},
+    header{reinterpret_cast<const FileHeader *>(this->file.data())},
+    sections{reinterpret_cast<const Section *>(this->file.data() + sizeof(FileHeader))},
+    symbols{&symbols} {}
+
+
+std::optional<MappedTree> MappedTree::open(
+    const std::filesystem::path &path,
+    uint64_t grammar_hash,
+    uint64_t source_hash,
+    util::SymbolTable &symbols
+) {
+    util::MappedFile file{};
+
+    try {
+        file = util::MappedFile::open(path);
+    } catch (const util::FileError &e) {
+        DBG("No AST cache: %s", e.what());
+        return std::nullopt;
+    }
+
+    if (file.size() < sizeof(FileHeader) + sizeof(Section) * cache_format::section_count) {
+        DBG("Truncated AST cache");
+        return std::nullopt;
+    }
+
+    FileHeader header{};
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, cache_format::magic, sizeof(header.magic)) != 0
+        || header.version != cache_format::version
+        || header.section_count != cache_format::section_count
+        || header.schema_hash != Tree::schema_hash
+        || header.grammar_hash != grammar_hash) {
+
+        DBG("Incompatible AST cache");
+        return std::nullopt;
+    }
+
+    if (header.source_hash != source_hash) {
+        DBG("Stale AST cache");
+        return std::nullopt;
+    }
+
+    static constexpr auto layout = expected_layout();
+
+    for (size_t i = 0; i < cache_format::section_count; ++i) {
+        Section section{};
+        std::memcpy(&section, file.data() + sizeof(FileHeader) + sizeof(Section) * i, sizeof(section));
+
+        if (section.elem_size != layout[i].first || section.elem_align != layout[i].second) {
+            DBG("Incompatible AST cache section #%zu", i);
+            return std::nullopt;
+        }
+
+        if (section.count == 0) {
+            continue;
+        }
+
+        if (section.offset % section.elem_align != 0
+            || section.offset > file.size()
+            || section.count > (file.size() - section.offset) / section.elem_size) {
+
+            DBG("Corrupt AST cache section #%zu", i);
+            return std::nullopt;
+        }
+    }
+
+    MappedTree result{std::move(file), symbols};
+
+    // The identifier table is the only thing that references other sections' data directly
+    auto text = result.get_section<char>(cache_format::identifier_text_section);
+    for (const auto &entry : result.get_section<IdentifierEntry>(cache_format::identifier_entries_section)) {
+        if ((size_t)entry.offset + entry.size > text.size()) {
+            DBG("Corrupt AST cache identifier table");
+            return std::nullopt;
+        }
+    }
+
+    result.identifiers.resize(result.sections[cache_format::identifier_entries_section].count);
+
+    return result;
+}
+
+
+identifier MappedTree::operator[](ref<identifier> name) const {
+    assert(name && name.index < identifiers.size());
+
+    identifier &result = identifiers[name.index];
+
+    if (!result) {
+        auto entry = get_section<IdentifierEntry>(cache_format::identifier_entries_section)[name.index];
+        auto text = get_section<char>(cache_format::identifier_text_section);
+
+        result = symbols->intern(std::string_view{text.data() + entry.offset, entry.size});
+    }
+
+    return result;
+}
+
+
+Tree MappedTree::load() const {
+    Tree tree{};
+
+    tree.root = get_root();
+
+    size_t idx = 0;
+
+    auto load_all = [&](auto &... arrays) {
+        auto load_one = [&](auto &array) {
+            using elem_t = typename std::decay_t<decltype(array)>::value_type;
+
+            auto items = get_section<elem_t>(idx++);
+            array.assign(items.begin(), items.end());
+        };
+
+        (load_one(arrays), ...);
+    };
+
+    std::apply(load_all, tree.get_all_rows());
+    std::apply(load_all, tree.get_all_pools());
+
+    auto &names = tree.get_identifiers();
+    names.reserve(identifiers.size());
+    for (index_t i = 0; i < identifiers.size(); ++i) {
+        names.push_back((*this)[ref<identifier>{i}]);
+    }
+
+    return tree;
+}
+#pragma endregion MappedTree
+
+
+}  // namespace bondrewd::ast::flat
@@ -1,5 +1,13 @@
 #include <bondrewd/internal/arena.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <fmt/core.h>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+
 
 namespace bondrewd::util {
 
@@ -7,4 +15,138 @@ namespace bondrewd::util {
 Arena Arena::instance{};
 
 
+#pragma region Type registry
+namespace {
+
+
+struct TypeRegistry {
+    std::mutex mutex{};
+    std::vector<const std::type_info *> types{};
+};
+
+
+TypeRegistry &get_type_registry() {
+    static TypeRegistry registry{};
+
+    return registry;
+}
+
+
+std::string demangle(const char *name) {
+    #if __has_include(<cxxabi.h>)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+    if (status == 0 && demangled) {
+        std::string result{demangled};
+        free(demangled);
+        return result;
+    }
+    #endif
+
+    return name;
+}
+
+
+}  // namespace
+
+
+Arena::type_id_t Arena::register_type(const std::type_info &info) {
+    auto &registry = get_type_registry();
+    std::lock_guard lock{registry.mutex};
+
+    registry.types.push_back(&info);
+
+    return (type_id_t)(registry.types.size() - 1);
+}
+
+
+const std::type_info &Arena::get_type_info(type_id_t type) {
+    auto &registry = get_type_registry();
+    std::lock_guard lock{registry.mutex};
+
+    return *registry.types[type];
+}
+#pragma endregion Type registry
+
+
+#pragma region Statistics
+Arena::Stats Arena::get_stats() const {
+    Stats result{};
+
+    result.total_allocations = counters.total_allocations;
+    result.live_allocations = counters.live_allocations;
+    result.peak_live_allocations = counters.peak_live_allocations;
+    result.live_bytes = counters.live_bytes;
+    result.peak_live_bytes = counters.peak_live_bytes;
+    result.region_used_bytes = region.get_used_bytes();
+    result.region_reserved_bytes = region.get_reserved_bytes();
+    result.peak_region_reserved_bytes = region.get_peak_reserved_bytes();
+    result.region_pool_hits = region.get_pool_hits();
+    result.slot_table_size = allocations.size();
+    result.slot_reuses = counters.slot_reuses;
+    result.resets = counters.resets;
+
+    const size_t types = per_type.size();
+    for (type_id_t type = 0; type < types; ++type) {
+        const TypeCounters &type_counters = per_type[type];
+
+        if (type_counters.allocations == 0) {
+            continue;
+        }
+
+        const size_t size = type_counters.size;
+
+        result.per_type.push_back(TypeStats{
+            demangle(get_type_info(type).name()),
+            type_counters.allocations,
+            type_counters.live,
+            type_counters.allocations * size,
+            type_counters.live * size,
+        });
+    }
+
+    std::sort(result.per_type.begin(), result.per_type.end(), [](const TypeStats &a, const TypeStats &b) {
+        return a.bytes > b.bytes;
+    });
+
+    return result;
+}
+
+
+std::ostream &Arena::dump_stats(std::ostream &stream) const {
+    Stats stats = get_stats();
+
+    stream << fmt::format(
+        "Arena statistics:\n"
+        "  allocations:      {} total, {} live, {} peak\n"
+        "  requested bytes:  {} live, {} peak\n"
+        "  region bytes:     {} used, {} reserved, {} peak reserved\n"
+        "  recycled blocks:  {}\n"
+        "  slot table:       {} slots, {} reuses\n"
+        "  resets:           {}\n",
+        stats.total_allocations, stats.live_allocations, stats.peak_live_allocations,
+        stats.live_bytes, stats.peak_live_bytes,
+        stats.region_used_bytes, stats.region_reserved_bytes, stats.peak_region_reserved_bytes,
+        stats.region_pool_hits,
+        stats.slot_table_size, stats.slot_reuses,
+        stats.resets
+    );
+
+    if (!stats.per_type.empty()) {
+        stream << "  per type (count, bytes, live count, live bytes):\n";
+    }
+
+    for (const auto &type : stats.per_type) {
+        stream << fmt::format(
+            "    {:>8} {:>10} {:>8} {:>10}  {}\n",
+            type.allocations, type.bytes, type.live, type.live_bytes, type.name
+        );
+    }
+
+    return stream;
+}
+#pragma endregion Statistics
+
+
 };  // namespace bondrewd::util
@@ -0,0 +1,161 @@
+#include <bondrewd/internal/mapped_file.hpp>
+
+#include <fstream>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <fmt/core.h>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+namespace bondrewd::util {
+
+
+namespace {
+
+/**
+ * Reads everything `read_some(dst, max)` gives until it returns 0 (EOF).
+ *
+ * Used for whatever can't be mapped. Pipes, character devices and most of /proc
+ * report their size as 0 (or don't know it at all), so `size_hint` is only
+ * the initial capacity and the buffer grows as needed.
+ */
+template <typename ReadSome>
+size_t read_until_eof(std::unique_ptr<char[]> &buffer, size_t size_hint, ReadSome &&read_some) {
+    size_t capacity = std::max<size_t>(size_hint, 64 * 1024);
+    size_t size = 0;
+
+    buffer = std::make_unique<char[]>(capacity + 1);
+
+    while (true) {
+        if (size == capacity) {
+            capacity *= 2;
+
+            auto grown = std::make_unique<char[]>(capacity + 1);
+            std::memcpy(grown.get(), buffer.get(), size);
+            buffer = std::move(grown);
+        }
+
+        size_t count = read_some(buffer.get() + size, capacity - size);
+
+        if (count == 0) {
+            break;
+        }
+
+        size += count;
+    }
+
+    buffer[size] = '\0';
+
+    return size;
+}
+
+}  // namespace
+
+
+MappedFile MappedFile::open(const std::filesystem::path &path) {
+    MappedFile result{};
+
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw FileError(fmt::format("Failed to open {}: {}", path.string(), std::strerror(errno)));
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) < 0) {
+        int error = errno;
+        ::close(fd);
+        throw FileError(fmt::format("Failed to stat {}: {}", path.string(), std::strerror(error)));
+    }
+
+    // Only regular files have a meaningful st_size, so only they are mapped
+    if (S_ISREG(info.st_mode)) {
+        result.size_ = (size_t)info.st_size;
+
+        if (result.size_ == 0) {
+            // Empty files can't be mapped, but there's nothing to read either
+            ::close(fd);
+            result.data_ = "";
+            return result;
+        }
+
+        void *addr = ::mmap(nullptr, result.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (addr != MAP_FAILED) {
+            ::close(fd);
+            result.data_ = (const char *)addr;
+            result.mapped = true;
+            return result;
+        }
+
+        result.size_ = 0;
+    }
+
+    // Pipes, FIFOs, devices and the like are read from the same descriptor, since
+    // reopening them wouldn't give the same data (or would block)
+    try {
+        result.size_ = read_until_eof(result.buffer, S_ISREG(info.st_mode) ? (size_t)info.st_size : 0,
+                                      [&](char *dst, size_t max) -> size_t {
+            while (true) {
+                ssize_t count = ::read(fd, dst, max);
+
+                if (count >= 0) {
+                    return (size_t)count;
+                }
+
+                if (errno != EINTR) {
+                    throw FileError(fmt::format("Failed to read {}: {}", path.string(), std::strerror(errno)));
+                }
+            }
+        });
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    ::close(fd);
+#else
+    std::ifstream stream{path, std::ios::binary};
+    if (!stream) {
+        throw FileError(fmt::format("Failed to open {}", path.string()));
+    }
+
+    result.size_ = read_until_eof(result.buffer, 0, [&](char *dst, size_t max) -> size_t {
+        stream.read(dst, (std::streamsize)max);
+
+        if (stream.bad()) {
+            throw FileError(fmt::format("Failed to read {}", path.string()));
+        }
+
+        return (size_t)stream.gcount();
+    });
+#endif
+
+    result.data_ = result.buffer.get();
+
+    return result;
+}
+
+
+void MappedFile::close() noexcept {
+#if !defined(_WIN32)
+    if (mapped) {
+        ::munmap((void *)data_, size_);
+    }
+#endif
+
+    data_ = nullptr;
+    size_ = 0;
+    mapped = false;
+    buffer.reset();
+}
+
+
+}  // namespace bondrewd::util
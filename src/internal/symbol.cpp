@@ -0,0 +1,68 @@
+#include <bondrewd/internal/symbol.hpp>
+
+#include <cstring>
+#include <mutex>
+#include <limits>
+
+
+namespace bondrewd::util {
+
+
+SymbolTable SymbolTable::instance{};
+
+
+Symbol SymbolTable::intern(std::string_view text) {
+    {
+        std::shared_lock lock{mutex};
+
+        auto it = index.find(text);
+        if (it != index.end()) {
+            return Symbol{it->second};
+        }
+    }
+
+    std::unique_lock lock{mutex};
+
+    // Someone might have interned it while we were waiting for the lock
+    auto it = index.find(text);
+    if (it != index.end()) {
+        return Symbol{it->second};
+    }
+
+    if (index.size() >= std::numeric_limits<Symbol::id_t>::max()) {
+        throw std::length_error("Symbol table overflow");
+    }
+
+    // The text is stored right after its entry
+    void *memory = storage.allocate(sizeof(Symbol::Entry) + text.size(), alignof(Symbol::Entry));
+    char *data = (char *)memory + sizeof(Symbol::Entry);
+    std::memcpy(data, text.data(), text.size());
+
+    Symbol::Entry *entry = new (memory) Symbol::Entry{std::string_view{data, text.size()}, (Symbol::id_t)index.size()};
+
+    index.emplace(entry->text, entry);
+
+    return Symbol{entry};
+}
+
+
+Symbol SymbolTable::find(std::string_view text) const {
+    std::shared_lock lock{mutex};
+
+    auto it = index.find(text);
+    if (it != index.end()) {
+        return Symbol{it->second};
+    }
+
+    return Symbol{};
+}
+
+
+size_t SymbolTable::size() const {
+    std::shared_lock lock{mutex};
+
+    return index.size();
+}
+
+
+}  // namespace bondrewd::util
@@ -1,10 +1,256 @@
 #include <bondrewd/lex/lexer.hpp>
+#include <bondrewd/lex/scan_kernels.hpp>
+
+#include <thread>
+#include <exception>
 
 
 namespace bondrewd::lex {
 
 
-//
+#pragma region Chunk boundaries
+namespace {
+
+
+/// Returns the offset just past the string starting at pos, or npos if it's unterminated
+size_t skip_string(std::string_view text, size_t pos) {
+    const char quote = text[pos];
+    const size_t size = text.size();
+
+    auto is_triple_at = [&](size_t at) {
+        return size - at >= 3 && text[at] == quote && text[at + 1] == quote && text[at + 2] == quote;
+    };
+
+    const bool is_triple = is_triple_at(pos);
+
+    pos += is_triple ? 3 : 1;
+
+    while (pos < size) {
+        const char c = text[pos];
+
+        if (c == '\\') {
+            // Only escaped newlines and quotes matter, and those are always a single character
+            pos += 2;
+            continue;
+        }
+
+        if (c == quote) {
+            if (!is_triple) {
+                return pos + 1;
+            }
+
+            if (is_triple_at(pos)) {
+                return pos + 3;
+            }
+        }
+
+        if (c == '\n' && !is_triple) {
+            return std::string_view::npos;
+        }
+
+        ++pos;
+    }
+
+    return std::string_view::npos;
+}
+
+
+}  // namespace
+
+
+// Mirrors the comment and string syntax from tools/tokens/generate_tokens.py
+std::vector<size_t> Lexer::find_chunk_boundaries(std::string_view text, size_t count) {
+    std::vector<size_t> result{};
+
+    if (count <= 1) {
+        return result;
+    }
+
+    const auto &kernels = kernels::get_kernels();
+    const char *data = text.data();
+    const size_t size = text.size();
+
+    size_t next_target = size / count;
+    size_t pos = 0;
+    unsigned comment_depth = 0;
+
+    auto skip_line = [&]() {
+        pos = kernels.find_newline(data + pos, data + size) - data;
+    };
+
+    while (pos < size && result.size() + 1 < count) {
+        const std::string_view rest = text.substr(pos);
+
+        if (comment_depth > 0) {
+            if (rest.starts_with("/*")) {
+                ++comment_depth;
+                pos += 2;
+            } else if (rest.starts_with("*/")) {
+                --comment_depth;
+                pos += 2;
+            } else {
+                pos = kernels.find_comment_delim(data + pos + 1, data + size) - data;
+            }
+
+            continue;
+        }
+
+        switch (rest[0]) {
+        case '\n': {
+            ++pos;
+
+            if (pos >= next_target && pos < size) {
+                result.push_back(pos);
+                next_target = pos + (size - pos) / (count - result.size());
+            }
+        } break;
+
+        case '#': {
+            skip_line();
+        } break;
+
+        case '/': {
+            if (rest.starts_with("//")) {
+                skip_line();
+            } else if (rest.starts_with("/*")) {
+                comment_depth = 1;
+                pos += 2;
+            } else {
+                ++pos;
+            }
+        } break;
+
+        case '\'':
+        case '"': {
+            pos = skip_string(text, pos);
+
+            if (pos == std::string_view::npos) {
+                // The tokenizer will report this
+                return result;
+            }
+        } break;
+
+        default: {
+            ++pos;
+        } break;
+        }
+    }
+
+    return result;
+}
+#pragma endregion Chunk boundaries
+
+
+#pragma region Pretokenization
+namespace {
+
+
+struct ChunkResult {
+    TokenBuffer tokens{};
+    /// The first token at or past the chunk's end, which must start the next chunk
+    SrcLocation::offset_t sync_offset{0};
+    TokenType sync_type{TokenType::endmarker};
+    std::exception_ptr error{};
+
+    SrcLocation::offset_t get_first_offset() const {
+        return tokens.empty() ? sync_offset : tokens.get_location(0).file_pos;
+    }
+
+    TokenType get_first_type() const {
+        return tokens.empty() ? sync_type : tokens.get_type(0);
+    }
+};
+
+
+void lex_chunk(const SourceBuffer::ptr_t &source, size_t begin, size_t end, ChunkResult &result) {
+    try {
+        Scanner scanner{source};
+        scanner.seek(source->location_at(begin));
+
+        Tokenizer tokenizer{std::move(scanner)};
+
+        while (true) {
+            Token token = tokenizer.get_token();
+
+            if (token.get_location().file_pos >= end && end < source->size()) {
+                result.sync_offset = token.get_location().file_pos;
+                result.sync_type = token.get_type();
+                break;
+            }
+
+            result.tokens.push(token);
+
+            if (token.is_endmarker()) {
+                break;
+            }
+        }
+    } catch (...) {
+        result.error = std::current_exception();
+    }
+}
+
+
+}  // namespace
+
+
+Lexer Lexer::pretokenize(SourceBuffer::ptr_t source, unsigned max_threads) {
+    if (max_threads == 0) {
+        max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    size_t chunk_count = std::min<size_t>(max_threads, source->size() / min_parallel_chunk_size);
+
+    std::vector<size_t> boundaries = find_chunk_boundaries(source->view(), chunk_count);
+    boundaries.insert(boundaries.begin(), 0);
+    boundaries.push_back(source->size());
+
+    if (boundaries.size() > 2) {
+        std::vector<ChunkResult> chunks(boundaries.size() - 1);
+
+        {
+            std::vector<std::jthread> threads{};
+            threads.reserve(chunks.size() - 1);
+
+            for (size_t i = 1; i < chunks.size(); ++i) {
+                threads.emplace_back(lex_chunk, std::cref(source), boundaries[i], boundaries[i + 1], std::ref(chunks[i]));
+            }
+
+            lex_chunk(source, boundaries[0], boundaries[1], chunks[0]);
+        }
+
+        // A chunk is only valid if the previous one, lexed past its end, runs into the same token.
+        // Otherwise a boundary has been misplaced (or there's a genuine error), and the sequential
+        // lexer below sorts it out
+        bool valid = true;
+
+        for (size_t i = 0; i < chunks.size() && valid; ++i) {
+            valid = !chunks[i].error;
+
+            if (valid && i > 0) {
+                valid = chunks[i - 1].sync_offset == chunks[i].get_first_offset() &&
+                        chunks[i - 1].sync_type == chunks[i].get_first_type();
+            }
+        }
+
+        if (valid) {
+            TokenBuffer tokens = std::move(chunks[0].tokens);
+
+            for (size_t i = 1; i < chunks.size(); ++i) {
+                tokens.append(std::move(chunks[i].tokens));
+            }
+
+            return Lexer{Tokenizer::from_buffer(std::move(source)), std::move(tokens)};
+        }
+
+        DBG("Chunked lexing failed verification, falling back to sequential");
+    }
+
+    Lexer result = Lexer::from_buffer(std::move(source));
+    result.tokenize_all();
+
+    return result;
+}
+#pragma endregion Pretokenization
 
 
 }  // namespace bondrewd::lex
@@ -0,0 +1,46 @@
+#include <bondrewd/lex/line_index.hpp>
+#include <bondrewd/lex/scan_kernels.hpp>
+
+#include <algorithm>
+
+
+namespace bondrewd::lex {
+
+
+void LineIndex::extend(std::string_view chunk) {
+    const auto &kernels = kernels::get_kernels();
+
+    const char *begin = chunk.data();
+    const char *end = chunk.data() + chunk.size();
+
+    for (const char *cur = kernels.find_newline(begin, end); cur != end; cur = kernels.find_newline(cur + 1, end)) {
+        line_starts.push_back((offset_t)(indexed_size + (cur - begin) + 1));
+    }
+
+    indexed_size += chunk.size();
+}
+
+
+unsigned LineIndex::get_line(offset_t file_pos) const {
+    auto next = std::upper_bound(line_starts.begin(), line_starts.end(), file_pos);
+    assert(next != line_starts.begin());
+
+    return (unsigned)(next - line_starts.begin() - 1);
+}
+
+
+unsigned LineIndex::measure_column(std::string_view line_prefix) {
+    const auto &kernels = kernels::get_kernels();
+
+    const char *begin = line_prefix.data();
+    const char *end = line_prefix.data() + line_prefix.size();
+
+    unsigned result = (unsigned)line_prefix.size();
+    result += 3 * (unsigned)kernels.count_byte(begin, end, '\t');
+    result -= (unsigned)kernels.count_byte(begin, end, '\r');
+
+    return result;
+}
+
+
+}  // namespace bondrewd::lex
@@ -0,0 +1,31 @@
+#include <bondrewd/lex/literal_pool.hpp>
+
+#include <cstring>
+
+
+namespace bondrewd::lex {
+
+
+std::string_view LiteralPool::store(std::string_view value) {
+    if (value.empty()) {
+        return {};
+    }
+
+    std::lock_guard lock{mutex};
+
+    // Literals are never freed one by one, so they don't need size classes
+    char *data = region.allocate_unpooled<char>(value.size());
+    std::memcpy(data, value.data(), value.size());
+
+    return std::string_view(data, value.size());
+}
+
+
+size_t LiteralPool::get_memory_usage() const {
+    std::lock_guard lock{mutex};
+
+    return region.get_reserved_bytes();
+}
+
+
+}  // namespace bondrewd::lex
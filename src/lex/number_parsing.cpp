@@ -0,0 +1,205 @@
+#include <bondrewd/lex/number_parsing.hpp>
+
+#include <charconv>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <bit>
+#include <algorithm>
+
+
+namespace bondrewd::lex::numbers {
+
+
+#pragma region Digits
+namespace {
+
+
+constexpr uint64_t repeat_byte(uint8_t value) {
+    return 0x0101010101010101ull * value;
+}
+
+/// Little-endian, so that the first digit is in the lowest byte
+inline uint64_t load8(const char *ptr) {
+    uint64_t result = 0;
+    std::memcpy(&result, ptr, sizeof(result));
+
+    if constexpr (std::endian::native == std::endian::big) {
+        result = __builtin_bswap64(result);
+    }
+
+    return result;
+}
+
+inline unsigned digit_value(char c) {
+    return c <= '9' ? (unsigned)(c - '0') : (unsigned)((c | 0x20) - 'a' + 10);
+}
+
+/// The values of 8 digits at once, one per byte
+inline uint64_t digit_values8(uint64_t chars, unsigned base) {
+    if (base == 16) {
+        // Letters are 0x41-0x46 or 0x61-0x66, so bit 6 tells them apart from '0'-'9'
+        return (chars & repeat_byte(0x0F)) + ((chars >> 6) & repeat_byte(0x01)) * 9;
+    }
+
+    return chars - repeat_byte('0');
+}
+
+/**
+ * Combines 8 digit values (the most significant one in the lowest byte) into a number.
+ *
+ * Neighbouring pairs of lanes are merged three times, doubling the lane width each time.
+ * For bases up to 16 the lanes never overflow.
+ */
+inline uint64_t combine8(uint64_t values, uint64_t base) {
+    values = (values * base + (values >> 8)) & 0x00FF00FF00FF00FFull;
+    values = (values * (base * base) + (values >> 16)) & 0x0000FFFF0000FFFFull;
+
+    return (values * (base * base * base * base) + (values >> 32)) & 0xFFFFFFFFull;
+}
+
+/// The most significant digits a 64-bit value may have in the base
+constexpr size_t max_digits(unsigned base) {
+    switch (base) {
+    case 2:
+        return 64;
+
+    case 8:
+        return 22;
+
+    case 10:
+        return 20;
+
+    default:
+        return 16;
+    }
+}
+
+
+}  // namespace
+
+
+std::optional<uint64_t> parse_integer(std::string_view digits, unsigned base) noexcept {
+    assert(base == 2 || base == 8 || base == 10 || base == 16);
+
+    // Leading zeros don't count towards the length
+    size_t start = digits.find_first_not_of('0');
+
+    if (start == std::string_view::npos) {
+        return 0;
+    }
+
+    digits.remove_prefix(start);
+
+    if (digits.size() > max_digits(base)) {
+        return std::nullopt;
+    }
+
+    const char *cur = digits.data();
+    const char *end = digits.data() + digits.size();
+
+    const uint64_t chunk_scale = (uint64_t)base * base * base * base * base * base * base * base;
+    uint64_t result = 0;
+
+    for (; end - cur >= 8; cur += 8) {
+        uint64_t chunk = combine8(digit_values8(load8(cur), base), base);
+
+        if (__builtin_mul_overflow(result, chunk_scale, &result) || __builtin_add_overflow(result, chunk, &result)) {
+            return std::nullopt;
+        }
+    }
+
+    for (; cur != end; ++cur) {
+        if (__builtin_mul_overflow(result, (uint64_t)base, &result) || __builtin_add_overflow(result, (uint64_t)digit_value(*cur), &result)) {
+            return std::nullopt;
+        }
+    }
+
+    return result;
+}
+#pragma endregion Digits
+
+
+#pragma region Floats
+double parse_decimal_float(std::string_view text) noexcept {
+    double result = 0;
+
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result, std::chars_format::general);
+
+    assert(end == text.data() + text.size() || error != std::errc{});
+
+    if (error == std::errc::result_out_of_range) {
+        // from_chars doesn't tell overflow from underflow, but strtod does, and it's rare enough
+        result = std::strtod(std::string(text).c_str(), nullptr);
+    }
+
+    return result;
+}
+
+
+double parse_binary_float(std::string_view integral, std::string_view fraction,
+                          int64_t exponent, unsigned base) noexcept {
+    assert(base == 2 || base == 8 || base == 16);
+
+    const unsigned digit_bits = (unsigned)std::countr_zero(base);
+
+    // The value is mantissa * 2**binary_exponent, plus something below the mantissa's last bit if sticky
+    uint64_t mantissa = 0;
+    int64_t binary_exponent = 0;
+    bool sticky = false;
+
+    auto feed = [&](std::string_view digits, bool is_fraction) {
+        for (char c : digits) {
+            unsigned value = digit_value(c);
+
+            if ((mantissa >> (64 - digit_bits)) == 0) {
+                mantissa = (mantissa << digit_bits) | value;
+                binary_exponent -= is_fraction ? digit_bits : 0;
+            } else {
+                sticky |= value != 0;
+                binary_exponent += is_fraction ? 0 : digit_bits;
+            }
+        }
+    };
+
+    feed(integral, false);
+    feed(fraction, true);
+
+    if (mantissa == 0) {
+        return 0.0;
+    }
+
+    // Anything beyond this is an overflow or an underflow anyway
+    constexpr int64_t max_exponent = (int64_t)1 << 40;
+    binary_exponent += std::clamp(exponent, -max_exponent, max_exponent) * digit_bits;
+
+    // Round to 53 bits, or fewer if the result is subnormal
+    const int64_t width = std::bit_width(mantissa);
+    const int64_t shift = std::max<int64_t>(width - 53, -1074 - binary_exponent);
+
+    if (shift > 64) {
+        // Less than half of the smallest subnormal
+        return 0.0;
+    }
+
+    if (shift > 0) {
+        const uint64_t kept = shift == 64 ? 0 : mantissa >> shift;
+        const uint64_t rest = shift == 64 ? mantissa : mantissa & (((uint64_t)1 << shift) - 1);
+        const uint64_t half = (uint64_t)1 << (shift - 1);
+
+        mantissa = kept;
+        binary_exponent += shift;
+
+        if (rest > half || (rest == half && (sticky || (kept & 1)))) {
+            ++mantissa;
+        }
+    }
+
+    // The mantissa fits into a double exactly now, so this is only rounded on overflow (to infinity)
+    return std::ldexp((double)mantissa, (int)std::min<int64_t>(binary_exponent, 2048));
+}
+#pragma endregion Floats
+
+
+}  // namespace bondrewd::lex::numbers
@@ -0,0 +1,426 @@
+#include <bondrewd/lex/scan_kernels.hpp>
+
+#include <cstring>
+#include <cstdint>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BONDREWD_KERNELS_SSE2 1
+#include <immintrin.h>
+#endif
+
+// AVX2 is used through per-function target attributes, so the rest of the
+// binary doesn't require it. That needs GCC or Clang.
+#if BONDREWD_KERNELS_SSE2 && (defined(__GNUC__) || defined(__clang__))
+#define BONDREWD_KERNELS_AVX2 1
+#define BONDREWD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+
+namespace bondrewd::lex::kernels {
+
+
+#pragma region Scalar
+namespace scalar {
+
+
+inline bool is_space(char c) {
+    return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+inline bool is_name(char c) {
+    return (unsigned char)((c | 0x20) - 'a') < 26 || (unsigned char)(c - '0') < 10 || c == '_';
+}
+
+const char *skip_space(const char *begin, const char *end) {
+    while (begin != end && is_space(*begin)) {
+        ++begin;
+    }
+
+    return begin;
+}
+
+const char *skip_name(const char *begin, const char *end) {
+    while (begin != end && is_name(*begin)) {
+        ++begin;
+    }
+
+    return begin;
+}
+
+const char *find_newline(const char *begin, const char *end) {
+    if (begin == end) {
+        return end;
+    }
+
+    const void *result = std::memchr(begin, '\n', end - begin);
+
+    return result ? (const char *)result : end;
+}
+
+const char *find_comment_delim(const char *begin, const char *end) {
+    while (begin != end && *begin != '*' && *begin != '/') {
+        ++begin;
+    }
+
+    return begin;
+}
+
+const char *find_string_delim(const char *begin, const char *end) {
+    while (begin != end && *begin != '\'' && *begin != '"' && *begin != '\\' && *begin != '\n') {
+        ++begin;
+    }
+
+    return begin;
+}
+
+size_t count_byte(const char *begin, const char *end, char c) {
+    size_t result = 0;
+
+    for (; begin != end; ++begin) {
+        result += *begin == c;
+    }
+
+    return result;
+}
+
+
+constexpr KernelSet kernel_set{
+    "scalar",
+    skip_space,
+    skip_name,
+    find_newline,
+    find_comment_delim,
+    find_string_delim,
+    count_byte,
+};
+
+
+}  // namespace scalar
+#pragma endregion Scalar
+
+
+#if BONDREWD_KERNELS_SSE2
+#pragma region SSE2
+namespace sse2 {
+
+
+constexpr size_t width = 16;
+
+inline __m128i in_range(__m128i v, char lo, char hi) {
+    // Unsigned v - lo <= hi - lo
+    __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+
+    return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8((char)(hi - lo))), shifted);
+}
+
+inline __m128i eq(__m128i v, char c) {
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+
+inline __m128i space_mask(__m128i v) {
+    return _mm_or_si128(eq(v, ' '), in_range(v, '\t', '\r'));
+}
+
+inline __m128i name_mask(__m128i v) {
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+
+    return _mm_or_si128(
+        _mm_or_si128(in_range(lower, 'a', 'z'), in_range(v, '0', '9')),
+        eq(v, '_')
+    );
+}
+
+inline __m128i comment_delim_mask(__m128i v) {
+    return _mm_or_si128(eq(v, '*'), eq(v, '/'));
+}
+
+inline __m128i string_delim_mask(__m128i v) {
+    return _mm_or_si128(
+        _mm_or_si128(eq(v, '\''), eq(v, '"')),
+        _mm_or_si128(eq(v, '\\'), eq(v, '\n'))
+    );
+}
+
+inline uint32_t movemask(__m128i v) {
+    return (uint32_t)_mm_movemask_epi8(v);
+}
+
+inline __m128i load(const char *ptr) {
+    return _mm_loadu_si128((const __m128i *)ptr);
+}
+
+const char *skip_space(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t stop = ~movemask(space_mask(load(begin))) & 0xFFFF;
+
+        if (stop) {
+            return begin + std::countr_zero(stop);
+        }
+    }
+
+    return scalar::skip_space(begin, end);
+}
+
+const char *skip_name(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t stop = ~movemask(name_mask(load(begin))) & 0xFFFF;
+
+        if (stop) {
+            return begin + std::countr_zero(stop);
+        }
+    }
+
+    return scalar::skip_name(begin, end);
+}
+
+const char *find_newline(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t found = movemask(eq(load(begin), '\n'));
+
+        if (found) {
+            return begin + std::countr_zero(found);
+        }
+    }
+
+    return scalar::find_newline(begin, end);
+}
+
+const char *find_comment_delim(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t found = movemask(comment_delim_mask(load(begin)));
+
+        if (found) {
+            return begin + std::countr_zero(found);
+        }
+    }
+
+    return scalar::find_comment_delim(begin, end);
+}
+
+const char *find_string_delim(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t found = movemask(string_delim_mask(load(begin)));
+
+        if (found) {
+            return begin + std::countr_zero(found);
+        }
+    }
+
+    return scalar::find_string_delim(begin, end);
+}
+
+size_t count_byte(const char *begin, const char *end, char c) {
+    size_t result = 0;
+
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        result += std::popcount(movemask(eq(load(begin), c)));
+    }
+
+    return result + scalar::count_byte(begin, end, c);
+}
+
+
+constexpr KernelSet kernel_set{
+    "sse2",
+    skip_space,
+    skip_name,
+    find_newline,
+    find_comment_delim,
+    find_string_delim,
+    count_byte,
+};
+
+
+}  // namespace sse2
+#pragma endregion SSE2
+#endif
+
+
+#if BONDREWD_KERNELS_AVX2
+#pragma region AVX2
+namespace avx2 {
+
+
+constexpr size_t width = 32;
+
+BONDREWD_TARGET_AVX2
+inline __m256i in_range(__m256i v, char lo, char hi) {
+    __m256i shifted = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8((char)(hi - lo))), shifted);
+}
+
+BONDREWD_TARGET_AVX2
+inline __m256i eq(__m256i v, char c) {
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+}
+
+BONDREWD_TARGET_AVX2
+inline __m256i space_mask(__m256i v) {
+    return _mm256_or_si256(eq(v, ' '), in_range(v, '\t', '\r'));
+}
+
+BONDREWD_TARGET_AVX2
+inline __m256i name_mask(__m256i v) {
+    __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+
+    return _mm256_or_si256(
+        _mm256_or_si256(in_range(lower, 'a', 'z'), in_range(v, '0', '9')),
+        eq(v, '_')
+    );
+}
+
+BONDREWD_TARGET_AVX2
+inline __m256i comment_delim_mask(__m256i v) {
+    return _mm256_or_si256(eq(v, '*'), eq(v, '/'));
+}
+
+BONDREWD_TARGET_AVX2
+inline __m256i string_delim_mask(__m256i v) {
+    return _mm256_or_si256(
+        _mm256_or_si256(eq(v, '\''), eq(v, '"')),
+        _mm256_or_si256(eq(v, '\\'), eq(v, '\n'))
+    );
+}
+
+BONDREWD_TARGET_AVX2
+inline uint32_t movemask(__m256i v) {
+    return (uint32_t)_mm256_movemask_epi8(v);
+}
+
+BONDREWD_TARGET_AVX2
+inline __m256i load(const char *ptr) {
+    return _mm256_loadu_si256((const __m256i *)ptr);
+}
+
+BONDREWD_TARGET_AVX2
+const char *skip_space(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t stop = ~movemask(space_mask(load(begin)));
+
+        if (stop) {
+            return begin + std::countr_zero(stop);
+        }
+    }
+
+    return sse2::skip_space(begin, end);
+}
+
+BONDREWD_TARGET_AVX2
+const char *skip_name(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t stop = ~movemask(name_mask(load(begin)));
+
+        if (stop) {
+            return begin + std::countr_zero(stop);
+        }
+    }
+
+    return sse2::skip_name(begin, end);
+}
+
+BONDREWD_TARGET_AVX2
+const char *find_newline(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t found = movemask(eq(load(begin), '\n'));
+
+        if (found) {
+            return begin + std::countr_zero(found);
+        }
+    }
+
+    return sse2::find_newline(begin, end);
+}
+
+BONDREWD_TARGET_AVX2
+const char *find_comment_delim(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t found = movemask(comment_delim_mask(load(begin)));
+
+        if (found) {
+            return begin + std::countr_zero(found);
+        }
+    }
+
+    return sse2::find_comment_delim(begin, end);
+}
+
+BONDREWD_TARGET_AVX2
+const char *find_string_delim(const char *begin, const char *end) {
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        uint32_t found = movemask(string_delim_mask(load(begin)));
+
+        if (found) {
+            return begin + std::countr_zero(found);
+        }
+    }
+
+    return sse2::find_string_delim(begin, end);
+}
+
+BONDREWD_TARGET_AVX2
+size_t count_byte(const char *begin, const char *end, char c) {
+    size_t result = 0;
+
+    for (; end - begin >= (ptrdiff_t)width; begin += width) {
+        result += std::popcount(movemask(eq(load(begin), c)));
+    }
+
+    return result + sse2::count_byte(begin, end, c);
+}
+
+
+constexpr KernelSet kernel_set{
+    "avx2",
+    skip_space,
+    skip_name,
+    find_newline,
+    find_comment_delim,
+    find_string_delim,
+    count_byte,
+};
+
+
+}  // namespace avx2
+#pragma endregion AVX2
+#endif
+
+
+#pragma region Selection
+namespace {
+
+
+const KernelSet &select_kernels() noexcept {
+#if BONDREWD_KERNELS_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        return avx2::kernel_set;
+    }
+#endif
+
+#if BONDREWD_KERNELS_SSE2
+    // SSE2 is part of the x86-64 baseline
+    return sse2::kernel_set;
+#else
+    return scalar::kernel_set;
+#endif
+}
+
+
+}  // namespace
+
+
+const KernelSet &get_kernels() noexcept {
+    static const KernelSet &kernels = select_kernels();
+
+    return kernels;
+}
+
+
+const KernelSet &get_scalar_kernels() noexcept {
+    return scalar::kernel_set;
+}
+#pragma endregion Selection
+
+
+}  // namespace bondrewd::lex::kernels
@@ -1,10 +1,131 @@
 #include <bondrewd/lex/scanner.hpp>
+#include <bondrewd/lex/error.hpp>
+
+#include <fmt/core.h>
 
 
 namespace bondrewd::lex {
 
 
-//
+void Scanner::advance_over(std::string_view run) {
+    assert(run.data() == buf.data() + (loc.file_pos - base));
+
+    loc.file_pos += (SrcLocation::offset_t)run.size();
+    cached_char = get_at(loc.file_pos);
+}
+
+
+bool Scanner::refill(size_t pos) const {
+    assert(stream);
+
+    while (pos - base >= buf.size()) {
+        if (stream_done) {
+            return false;
+        }
+
+        // The token being scanned is carried over, so that it's contiguous in the new window.
+        // So is the character before it, for peek_prev()
+        size_t keep_from = std::min<size_t>(mark, loc.file_pos);
+        keep_from = std::clamp(keep_from > 0 ? keep_from - 1 : 0, base, base + buf.size());
+        std::string_view kept = buf.substr(keep_from - base);
+
+        // The window grows with the token: reading at least as much as is carried over means
+        // a long token is only copied a logarithmic number of times, and the windows
+        // it leaves behind take up about twice its size in total, not its size squared
+        size_t to_read = std::max(chunk_size, kept.size());
+
+        auto data = std::make_unique<std::string>();
+        data->resize(kept.size() + to_read);
+        std::copy(kept.begin(), kept.end(), data->begin());
+
+        stream->read(data->data() + kept.size(), (std::streamsize)to_read);
+        size_t count = (size_t)stream->gcount();
+
+        if (count < to_read) {
+            stream_done = true;
+        }
+
+        if (count == 0) {
+            return false;
+        }
+
+        data->resize(kept.size() + count);
+
+        if (keep_from + data->size() > SrcLocation::max_file_size) {
+            throw LexicalError{fmt::format("Input '{}' is too large", source->get_name())};
+        }
+
+        stream_lines.extend(std::string_view(*data).substr(kept.size()));
+
+        base = keep_from;
+        buf = *data;
+        segments.push_back(Segment{keep_from, std::move(data)});
+    }
+
+    return true;
+}
+
+
+std::string_view Scanner::view_range(size_t file_pos, size_t size) const {
+    if (!stream) {
+        assert(file_pos + size <= buf.size());
+
+        return buf.substr(file_pos, size);
+    }
+
+    // Recent tokens are the likeliest to be asked for
+    for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+        if (it->base <= file_pos && file_pos + size <= it->base + it->data->size()) {
+            return std::string_view(*it->data).substr(file_pos - it->base, size);
+        }
+    }
+
+    return {};
+}
+
+
+SrcPosition Scanner::resolve(const SrcLocation &pos) const {
+    assert(pos.file_id == source->get_id());
+
+    if (!stream) {
+        return source->resolve(pos);
+    }
+
+    assert(pos.file_pos <= stream_lines.get_indexed_size());
+
+    unsigned line = stream_lines.get_line(pos.file_pos);
+    size_t line_start = stream_lines.get_line_start(line);
+    unsigned column = (unsigned)(pos.file_pos - line_start);
+
+    if (line_start >= base) {
+        column = LineIndex::measure_column(buf.substr(line_start - base, pos.file_pos - line_start));
+    }
+
+    return SrcPosition{source->get_name(), line, column};
+}
+
+
+void Scanner::discard_before(size_t file_pos) {
+    // The current window is never discarded
+    while (segments.size() > 1 && segments.front().base + segments.front().data->size() <= file_pos) {
+        segments.pop_front();
+    }
+}
+
+
+size_t Scanner::get_retained_size() const {
+    if (!stream) {
+        return buf.size();
+    }
+
+    size_t result = 0;
+
+    for (const auto &segment : segments) {
+        result += segment.data->size();
+    }
+
+    return result;
+}
 
 
 }  // namespace bondrewd::lex
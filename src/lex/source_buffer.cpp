@@ -0,0 +1,80 @@
+#include <bondrewd/lex/source_buffer.hpp>
+#include <bondrewd/lex/source_manager.hpp>
+
+#include <fmt/core.h>
+
+
+namespace bondrewd::lex {
+
+
+SourceBuffer::ptr_t SourceBuffer::from_file(const std::filesystem::path &path) {
+    return SourceManager::instance.load_file(path);
+}
+
+
+SourceBuffer::ptr_t SourceBuffer::from_string(std::string text, std::string name) {
+    return SourceManager::instance.add_string(std::move(text), std::move(name));
+}
+
+
+SourceBuffer::ptr_t SourceBuffer::from_stream(std::istream &input, std::string name) {
+    return SourceManager::instance.add_stream(input, std::move(name));
+}
+
+
+const LineIndex &SourceBuffer::get_line_index() const {
+    std::call_once(lines_built, [this]() {
+        lines.extend(data);
+    });
+
+    return lines;
+}
+
+
+SrcPosition SourceBuffer::resolve(const SrcLocation &loc) const {
+    assert(loc.file_id == id);
+
+    if (is_streamed_) {
+        return SrcPosition{name, 0, 0};
+    }
+
+    assert(loc.file_pos <= size());
+
+    const LineIndex &index = get_line_index();
+    unsigned line = index.get_line(loc.file_pos);
+    size_t line_start = index.get_line_start(line);
+
+    return SrcPosition{
+        name,
+        line,
+        LineIndex::measure_column(data.substr(line_start, loc.file_pos - line_start))
+    };
+}
+
+
+std::string_view SourceBuffer::view_line(const SrcLocation &loc) const {
+    assert(loc.file_id == id);
+
+    if (is_streamed_) {
+        return {};
+    }
+
+    assert(loc.file_pos <= size());
+
+    const LineIndex &index = get_line_index();
+    unsigned line = index.get_line(loc.file_pos);
+    size_t line_start = index.get_line_start(line);
+    size_t line_end = line + 1 < index.get_line_count() ? index.get_line_start(line + 1) - 1 : size();
+
+    return data.substr(line_start, line_end - line_start);
+}
+
+
+void SourceBuffer::check_size() const {
+    if (data.size() > SrcLocation::max_file_size) {
+        throw util::FileError(fmt::format("Source '{}' is too large ({} bytes)", name, data.size()));
+    }
+}
+
+
+}  // namespace bondrewd::lex
@@ -0,0 +1,111 @@
+#include <bondrewd/lex/source_manager.hpp>
+
+#include <sstream>
+#include <mutex>
+#include <stdexcept>
+#include <fmt/core.h>
+
+
+namespace bondrewd::lex {
+
+
+SourceManager SourceManager::instance{};
+
+
+template <typename ... As>
+SourceBuffer::ptr_t SourceManager::add(As &&... args) {
+    std::unique_lock lock{mutex};
+
+    if (buffers.size() >= std::numeric_limits<file_id_t>::max() - 1) {
+        throw std::length_error("Too many source files");
+    }
+
+    file_id_t id = (file_id_t)buffers.size() + 1;
+    static_assert(SrcLocation::no_file == 0);
+
+    // Buffers may throw from their constructors (e.g. if they're too large),
+    // in which case nothing has been registered yet
+    auto result = std::make_shared<const SourceBuffer>(id, std::forward<As>(args)...);
+    buffers.push_back(result);
+
+    return result;
+}
+
+
+SourceBuffer::ptr_t SourceManager::load_file(const std::filesystem::path &path) {
+    // Opened outside of the lock
+    util::MappedFile file = util::MappedFile::open(path);
+
+    return add(path.string(), std::move(file));
+}
+
+
+SourceBuffer::ptr_t SourceManager::add_string(std::string text, std::string name) {
+    return add(std::move(name), std::move(text));
+}
+
+
+SourceBuffer::ptr_t SourceManager::add_stream(std::istream &input, std::string name) {
+    std::ostringstream contents{};
+    contents << input.rdbuf();
+
+    return add_string(std::move(contents).str(), std::move(name));
+}
+
+
+SourceBuffer::ptr_t SourceManager::add_streamed(std::string name) {
+    return add(std::move(name), std::string{}, SourceBuffer::streamed);
+}
+
+
+void SourceManager::unload(file_id_t id) {
+    std::unique_lock lock{mutex};
+
+    if (id == SrcLocation::no_file || id > buffers.size()) {
+        return;
+    }
+
+    buffers[id - 1] = nullptr;
+}
+
+
+SourceBuffer::ptr_t SourceManager::get(file_id_t id) const {
+    std::shared_lock lock{mutex};
+
+    if (id == SrcLocation::no_file || id > buffers.size()) {
+        return nullptr;
+    }
+
+    return buffers[id - 1];
+}
+
+
+SourceBuffer::ptr_t SourceManager::get_checked(file_id_t id) const {
+    SourceBuffer::ptr_t result = get(id);
+
+    if (!result) {
+        throw std::out_of_range(fmt::format("Unknown file id {}", id));
+    }
+
+    return result;
+}
+
+
+SrcPosition SourceManager::resolve(const SrcLocation &loc) const {
+    return get_checked(loc.file_id)->resolve(loc);
+}
+
+
+std::string_view SourceManager::view_line(const SrcLocation &loc) const {
+    return get_checked(loc.file_id)->view_line(loc);
+}
+
+
+size_t SourceManager::size() const {
+    std::shared_lock lock{mutex};
+
+    return buffers.size();
+}
+
+
+}  // namespace bondrewd::lex
@@ -0,0 +1,241 @@
+#include <bondrewd/lex/token_buffer.hpp>
+
+
+namespace bondrewd::lex {
+
+
+void TokenBuffer::push(const Token &token) {
+    SrcLocation loc = token.get_location();
+
+    assert(empty() || loc.file_id == file_id);
+    file_id = loc.file_id;
+
+    subkind_t subkind = 0;
+    payload_t payload = no_payload;
+
+    switch (token.get_type()) {
+    case TokenType::endmarker: {
+    } break;
+
+    case TokenType::name: {
+        payload = add_payload(names, token.get_name().value);
+    } break;
+
+    case TokenType::number: {
+        const auto &number = token.get_number();
+
+        if (number.is_int()) {
+            subkind = (subkind_t)NumberKind::integer;
+            payload = add_payload(integers, number.get_int());
+        } else {
+            subkind = (subkind_t)NumberKind::floating;
+            payload = add_payload(floats, number.get_float());
+        }
+    } break;
+
+    case TokenType::string: {
+        const auto &string = token.get_string();
+
+        payload = add_payload(strings, StringPayload{string.value, string.quotes});
+    } break;
+
+    case TokenType::keyword: {
+        subkind = (subkind_t)token.get_keyword().value;
+    } break;
+
+    case TokenType::punct: {
+        subkind = (subkind_t)token.get_punct().value;
+    } break;
+
+    NODEFAULT;
+    }
+
+    codes.push_back(make_code(token.get_type(), subkind));
+    offsets.push_back(loc.file_pos);
+    lengths.push_back((length_t)token.get_source().size());
+    payloads.push_back(payload);
+}
+
+
+void TokenBuffer::append(TokenBuffer &&other) {
+    if (other.empty()) {
+        return;
+    }
+
+    assert(empty() || other.file_id == file_id);
+    file_id = other.file_id;
+
+    const size_t old_size = size();
+
+    codes.insert(codes.end(), other.codes.begin(), other.codes.end());
+    offsets.insert(offsets.end(), other.offsets.begin(), other.offsets.end());
+    lengths.insert(lengths.end(), other.lengths.begin(), other.lengths.end());
+    payloads.insert(payloads.end(), other.payloads.begin(), other.payloads.end());
+
+    // Payloads index into the side tables, so they have to be rebased past our own entries
+    const payload_t names_base = (payload_t)names.size();
+    const payload_t integers_base = (payload_t)integers.size();
+    const payload_t floats_base = (payload_t)floats.size();
+    const payload_t strings_base = (payload_t)strings.size();
+
+    for (size_t i = old_size; i < size(); ++i) {
+        switch (get_type(i)) {
+        case TokenType::name: {
+            payloads[i] += names_base;
+        } break;
+
+        case TokenType::number: {
+            payloads[i] += (NumberKind)get_subkind(i) == NumberKind::integer ? integers_base : floats_base;
+        } break;
+
+        case TokenType::string: {
+            payloads[i] += strings_base;
+        } break;
+
+        default:
+            break;
+        }
+    }
+
+    names.insert(names.end(), other.names.begin(), other.names.end());
+    integers.insert(integers.end(), other.integers.begin(), other.integers.end());
+    floats.insert(floats.end(), other.floats.begin(), other.floats.end());
+    strings.insert(strings.end(), other.strings.begin(), other.strings.end());
+
+    other.clear();
+}
+
+
+void TokenBuffer::reserve(size_t count) {
+    codes.reserve(count);
+    offsets.reserve(count);
+    lengths.reserve(count);
+    payloads.reserve(count);
+}
+
+
+void TokenBuffer::clear() {
+    codes.clear();
+    offsets.clear();
+    lengths.clear();
+    payloads.clear();
+
+    names.clear();
+    integers.clear();
+    floats.clear();
+    strings.clear();
+}
+
+
+void TokenBuffer::discard_front(size_t count) {
+    assert(count <= size());
+
+    if (count == 0) {
+        return;
+    }
+
+    // Payloads are added in token order, so the ones still in use are a suffix of each table
+    size_t names_cut = names.size();
+    size_t integers_cut = integers.size();
+    size_t floats_cut = floats.size();
+    size_t strings_cut = strings.size();
+
+    for (size_t i = count; i < size(); ++i) {
+        switch (get_type(i)) {
+        case TokenType::name: {
+            names_cut = std::min<size_t>(names_cut, payloads[i]);
+        } break;
+
+        case TokenType::number: {
+            size_t &cut = (NumberKind)get_subkind(i) == NumberKind::integer ? integers_cut : floats_cut;
+            cut = std::min<size_t>(cut, payloads[i]);
+        } break;
+
+        case TokenType::string: {
+            strings_cut = std::min<size_t>(strings_cut, payloads[i]);
+        } break;
+
+        default:
+            break;
+        }
+    }
+
+    codes.erase(codes.begin(), codes.begin() + count);
+    offsets.erase(offsets.begin(), offsets.begin() + count);
+    lengths.erase(lengths.begin(), lengths.begin() + count);
+    payloads.erase(payloads.begin(), payloads.begin() + count);
+
+    names.erase(names.begin(), names.begin() + names_cut);
+    integers.erase(integers.begin(), integers.begin() + integers_cut);
+    floats.erase(floats.begin(), floats.begin() + floats_cut);
+    strings.erase(strings.begin(), strings.begin() + strings_cut);
+
+    for (size_t i = 0; i < size(); ++i) {
+        switch (get_type(i)) {
+        case TokenType::name: {
+            payloads[i] -= (payload_t)names_cut;
+        } break;
+
+        case TokenType::number: {
+            payloads[i] -= (payload_t)((NumberKind)get_subkind(i) == NumberKind::integer ? integers_cut : floats_cut);
+        } break;
+
+        case TokenType::string: {
+            payloads[i] -= (payload_t)strings_cut;
+        } break;
+
+        default:
+            break;
+        }
+    }
+}
+
+
+Token TokenBuffer::get(size_t idx, const Scanner &scanner) const {
+    assert(idx < size());
+
+    SrcLocation loc = get_location(idx);
+    std::string_view source = scanner.view_range(loc.file_pos, lengths[idx]);
+    payload_t payload = payloads[idx];
+
+    switch (get_type(idx)) {
+    case TokenType::endmarker:
+        return Token::endmarker(loc, source);
+
+    case TokenType::name:
+        return Token::name(names[payload], loc, source);
+
+    case TokenType::number:
+        if ((NumberKind)get_subkind(idx) == NumberKind::integer) {
+            return Token::number(integers[payload], loc, source);
+        }
+
+        return Token::number(floats[payload], loc, source);
+
+    case TokenType::string:
+        return Token::string(strings[payload].value, strings[payload].quotes, loc, source);
+
+    case TokenType::keyword:
+        return Token::keyword(get_keyword(idx), loc, source);
+
+    case TokenType::punct:
+        return Token::punct(get_punct(idx), loc, source);
+
+    NODEFAULT;
+    }
+}
+
+
+size_t TokenBuffer::get_memory_usage() const noexcept {
+    return codes.capacity() * sizeof(code_t) +
+           offsets.capacity() * sizeof(offset_t) +
+           lengths.capacity() * sizeof(length_t) +
+           payloads.capacity() * sizeof(payload_t) +
+           names.capacity() * sizeof(util::Symbol) +
+           integers.capacity() * sizeof(int64_t) +
+           floats.capacity() * sizeof(double) +
+           strings.capacity() * sizeof(StringPayload);
+}
+
+
+}  // namespace bondrewd::lex
@@ -7,6 +7,8 @@ namespace bondrewd::lex {
 Token Tokenizer::get_token() {
     // Loop needed because of how comments are handled
     while ((void)scanner.skip_space(), scanner) {
+        scanner.mark_token_start();
+
         if (is_digit(scanner.cur()) || (scanner.cur() == '.' && is_digit(scanner.peek_next()))) {
             parse_number();
             return token;
@@ -27,67 +29,28 @@ Token Tokenizer::get_token() {
 }
 
 
-int64_t Tokenizer::extract_integer(std::string_view digits, unsigned base, const SrcLocation &loc) {
-    // Digits are assumed to be correct
-
-    int64_t result = 0;
-    bool allow_underscores = false;
-
-    for (char digit : digits) {
-        if (digit == '_') {
-            if (!allow_underscores)
-                error("Invalid underscore in integer literal", loc);
-            
-            allow_underscores = false;
-            continue;
-        }
-
-        // TODO: Maybe make MSVC-compatible?
-        if (__builtin_mul_overflow(result, base, &result))
-            error("Integer literal too large", loc);
-        if (__builtin_add_overflow(result, evaluate_digit(digit, base), &result))
-            error("Integer literal too large", loc);
-        
-        allow_underscores = true;
-    }
-
-    if (!allow_underscores)
-        error("Invalid underscore in integer literal", loc);
-
-    return result;
-}
-
-
-double Tokenizer::extract_float(std::string_view integral_part,
-                                std::string_view fractional_part,
-                                std::string_view exponent_part,
-                                int exponent_sign,
-                                unsigned base,
-                                const SrcLocation &loc) {
-    // Digits are assumed to be correct
-
-    double result = 0;
-
-    for (auto digit : integral_part) {
-        result *= base;
-        result += evaluate_digit(digit, base);
+std::string_view Tokenizer::strip_underscores(std::string_view digits, const SrcLocation &loc) {
+    if (digits.find('_') == std::string_view::npos) {
+        return digits;
     }
 
-    double fraction = 0;
-    for (auto digit : std::ranges::reverse_view(fractional_part)) {
-        fraction += evaluate_digit(digit, base);
-        fraction /= base;
+    // Underscores may only separate digits
+    if (digits.front() == '_' || digits.back() == '_' || digits.find("__") != std::string_view::npos) {
+        error("Invalid underscore in number literal", loc);
     }
 
-    result += fraction;
+    // The buffer has been reserved for the whole literal, so earlier results stay valid
+    assert(literal_buffer.capacity() - literal_buffer.size() >= digits.size());
 
-    if (exponent_sign != 0) {
-        int64_t exponent = extract_integer(exponent_part, base, loc);
+    size_t offset = literal_buffer.size();
 
-        result *= std::pow((double)base, exponent_sign * exponent);
+    for (char digit : digits) {
+        if (digit != '_') {
+            literal_buffer.push_back(digit);
+        }
     }
 
-    return result;
+    return std::string_view(literal_buffer).substr(offset);
 }
 
 
@@ -175,52 +138,84 @@ void Tokenizer::parse_number() {
         error("Invalid integer literal", start_pos);
     }
 
+    if (exp_sign != 0 && exp_part.empty()) {
+        error("Invalid floating point literal", start_pos);
+    }
+
     if (is_name_char(scanner.cur())) {
         error(fmt::format("Garbage '{}' after number", (char)scanner.cur()), scanner.tell());
     }
 
-    if (integral_part.size() >= MAX_NUMBER_LENGTH \
-        || fraction_part.size() >= MAX_NUMBER_LENGTH \
-        || exp_part.size() >= MAX_NUMBER_LENGTH) {
+    std::string_view source = scanner.view_since(start_pos);
 
-        error("Integer literal too large", start_pos);
-    }
+    literal_buffer.clear();
+    literal_buffer.reserve(source.size());
+
+    integral_part = strip_underscores(integral_part, start_pos);
+    fraction_part = strip_underscores(fraction_part, start_pos);
+    exp_part = strip_underscores(exp_part, start_pos);
 
     if (is_integer) {
-        token = Token::number(
-            extract_integer(integral_part, base, start_pos),
-            start_pos,
-            scanner.view_since(start_pos)
-        );
-    } else {
-        token = Token::number(
-            extract_float(integral_part, fraction_part, exp_part, exp_sign, base, start_pos),
-            start_pos,
-            scanner.view_since(start_pos)
-        );
+        auto value = numbers::parse_integer(integral_part, base);
+
+        if (!value || *value > (uint64_t)std::numeric_limits<int64_t>::max()) {
+            error("Integer literal too large", start_pos);
+        }
+
+        token = Token::number((int64_t)*value, start_pos, source);
+        return;
+    }
+
+    if (base == 10) {
+        // The source is in the right format already, unless it has underscores
+        std::string_view text = source;
+
+        if (text.find('_') != std::string_view::npos) {
+            literal_buffer.clear();
+            std::ranges::copy_if(source, std::back_inserter(literal_buffer), [](char c) { return c != '_'; });
+            text = literal_buffer;
+        }
+
+        token = Token::number(numbers::parse_decimal_float(text), start_pos, source);
+        return;
     }
 
+    int64_t exponent = 0;
+
+    if (exp_sign != 0) {
+        // Too large an exponent makes for an infinity or a zero anyway
+        auto value = numbers::parse_integer(exp_part, base);
+
+        exponent = exp_sign * (int64_t)std::min<uint64_t>(value.value_or(UINT64_MAX), INT64_MAX);
+    }
+
+    token = Token::number(numbers::parse_binary_float(integral_part, fraction_part, exponent, base), start_pos, source);
 }
 
 
 void Tokenizer::parse_name_or_keyword() {
-    parse_name();
-    assert(token.is_name());
+    auto start_pos = scanner.tell();
+
+    auto value = scanner.read_identifier();
+    assert(!value.empty());
 
-    auto keyword = string_to_keyword.find(token.get_name().value);
-    if (keyword != string_to_keyword.end()) {
-        token = Token::keyword(keyword->second, token.get_location(), token.get_source());
+    // Keywords are checked first, so that they don't get interned
+    if (auto keyword = lookup_keyword(value)) {
+        token = Token::keyword(*keyword, start_pos, value);
+        return;
     }
+
+    token = Token::name(symbols->intern(value), start_pos, value);
 }
 
 
 void Tokenizer::parse_name() {
     auto start_pos = scanner.tell();
 
-    auto value = scanner.read_while<is_name_char>();
+    auto value = scanner.read_identifier();
     assert(!value.empty());
 
-    token = Token::name(value, start_pos, value);
+    token = Token::name(symbols->intern(value), start_pos, value);
 }
 
 
@@ -237,7 +232,7 @@ bool Tokenizer::parse_other() {
         error(fmt::format("Unexpected character '{}'", (char)scanner.cur()), start_pos);
 
     case MiscTrie::Verdict::string_quote:
-        parse_string(quote);
+        parse_string(start_pos, quote);
         return true;
 
     case MiscTrie::Verdict::block_comment:
@@ -257,16 +252,25 @@ bool Tokenizer::parse_other() {
 }
 
 
-void Tokenizer::parse_string(std::string_view start_quote) {
+void Tokenizer::parse_string(const SrcLocation &token_start, std::string_view start_quote) {
     auto start_pos = scanner.tell();
-    std::string value = "";
     const bool is_multiline = start_quote.size() > 1;
 
-    // Actually, this ended up less efficient than the implementation of this
-    // I had in python (due to the fact that I'm using a separate switch-based trie here,
-    // instead of walking an explicit one while iterating over the input).
-    // The difference should be negligible, though.
+    // As long as there are no escapes, the value is exactly the source between the quotes,
+    // and nothing has to be copied. The first escape switches to decoding into literal_buffer
+    bool is_verbatim = true;
+
+    auto append = [this, &is_verbatim](std::string_view part) {
+        if (!is_verbatim) {
+            literal_buffer += part;
+        }
+    };
+
+    // Plain characters are consumed in bulk, so StringTrie is only entered
+    // at quotes, backslashes and newlines
     while (true) {
+        append(scanner.read_string_run());
+
         auto seg_start_pos = scanner.tell();
 
         std::string_view end_quote{};
@@ -285,23 +289,23 @@ void Tokenizer::parse_string(std::string_view start_quote) {
                 scanner.advance();
             }
 
-            value += scanner.view_since(seg_start_pos);
+            append(scanner.view_since(seg_start_pos));
         } break;
 
         case StringTrie::Verdict::end_quote: {
-            if (end_quote == start_quote) {
-                token = Token::string(value, start_quote, start_pos, value);
-                return;
-            }
-
             if (end_quote.starts_with(start_quote)) {
-                // This is a bit of a hack for cases like `"abc"""`
-                // We only want to consume the matching quote, not the extra ones
-                scanner.seek(seg_start_pos);
-                scanner.advance(end_quote.size());
+                if (end_quote != start_quote) {
+                    // This is a bit of a hack for cases like `"abc"""`
+                    // We only want to consume the matching quote, not the extra ones
+                    scanner.seek(seg_start_pos);
+                    scanner.advance(start_quote.size());
+                }
+
+                finish_string(token_start, start_quote, scanner.view_since(start_pos), is_verbatim);
+                return;
             }
 
-            value += scanner.view_since(seg_start_pos);
+            append(scanner.view_since(seg_start_pos));
         } break;
 
         case StringTrie::Verdict::newline: {
@@ -309,16 +313,23 @@ void Tokenizer::parse_string(std::string_view start_quote) {
                 error("Unterminated string", start_pos);
             }
 
-            value += '\n';
+            append("\n");
         } break;
 
         case StringTrie::Verdict::escape: {
+            if (is_verbatim) {
+                std::string_view verbatim = scanner.view_since(start_pos);
+
+                literal_buffer.assign(verbatim.substr(0, seg_start_pos.file_pos - start_pos.file_pos));
+                is_verbatim = false;
+            }
+
             if (escape == '\n' || escape == Scanner::end_of_file) {
                 break;
             }
 
             if (simple_escapes.contains((char)escape)) {
-                value += simple_escapes.at((char)escape);
+                literal_buffer += simple_escapes.at((char)escape);
                 break;
             }
 
@@ -334,7 +345,7 @@ void Tokenizer::parse_string(std::string_view start_quote) {
                                     + evaluate_digit_checked(digits[1], 16, seg_start_pos);
                 assert(hex_value < 0x100);
 
-                value += (char)hex_value;
+                literal_buffer += (char)hex_value;
                 break;
             }
 
@@ -347,6 +358,26 @@ void Tokenizer::parse_string(std::string_view start_quote) {
 }
 
 
+void Tokenizer::finish_string(const SrcLocation &token_start, std::string_view quotes,
+                              std::string_view contents, bool is_verbatim) {
+    std::string_view value{};
+
+    if (is_verbatim) {
+        // Contents include the closing quote
+        value = contents.substr(0, contents.size() - quotes.size());
+
+        // A stream's window moves on, so its literals can't be referenced in place
+        if (scanner.is_streaming()) {
+            value = scanner.get_source()->get_literals().store(value);
+        }
+    } else {
+        value = scanner.get_source()->get_literals().store(literal_buffer);
+    }
+
+    token = Token::string(value, quotes, token_start, scanner.view_since(token_start));
+}
+
+
 void Tokenizer::parse_line_comment() {
     // TODO: Handle special comments, like pragmas?
     scanner.skip_line();
@@ -360,6 +391,9 @@ void Tokenizer::parse_block_comment() {
     unsigned balance = 1;
 
     while (balance) {
+        // Comments aren't tokens, so streams needn't keep them (see Scanner::mark_token_start)
+        scanner.mark_token_start();
+
         auto verdict = BlockCommentTrie().feed(scanner);
 
         switch (verdict) {
@@ -368,7 +402,9 @@ void Tokenizer::parse_block_comment() {
                 error("Unterminated block comment", start_pos);
             }
 
+            // Nothing but '*' and '/' can start a delimiter
             scanner.advance();
+            scanner.skip_to_comment_delim();
         } break;
 
         case BlockCommentTrie::Verdict::start: {
@@ -1,4 +1,4 @@
-// AUTOGENERATED by bondrewd/tools/pegen++/pegenxx.py on 2023-06-07 19:23:02
+// AUTOGENERATED by bondrewd/tools/pegen++/pegenxx.py on 2026-10-17 10:04:32
 // DO NOT EDIT
 
 #include <bondrewd/parse/parser.gen.hpp>
@@ -10,6 +10,12 @@
 #define PARSER_DBG_(...)
 #endif
 
+#if BONDREWD_PARSER_PROFILE
+#define PARSER_PROFILE_(RULE)  auto _profile_guard = _profile_rule(RuleType::RULE, _state)
+#else
+#define PARSER_PROFILE_(RULE)
+#endif
+
 
 namespace bondrewd::parse {
 
@@ -24,6 +30,7 @@ std::optional<ast::field<ast::file>> Parser::parse_start_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(start);
     std::optional<ast::field<ast::file>> _res = std::nullopt;
     { // file
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "start", _state, tell(), "file");
@@ -43,7 +50,7 @@ std::optional<ast::field<ast::file>> Parser::parse_start_rule()
     return std::nullopt;
 }
 
-// file: stmt* $
+// file: top_level_stmt* $
 std::optional<ast::field<ast::file>> Parser::parse_file_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
@@ -51,28 +58,57 @@ std::optional<ast::field<ast::file>> Parser::parse_file_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(file);
     std::optional<ast::field<ast::file>> _res = std::nullopt;
-    { // stmt* $
-        PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "file", _state, tell(), "stmt* $");
+    { // top_level_stmt* $
+        PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "file", _state, tell(), "top_level_stmt* $");
         auto _user_opt_b = parse__loop0_1_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
-        auto _token = lexer.expect().token(lex::TokenType::endmarker);
+        auto _token = lexer.expect().accept(lex::TokenType::endmarker);
         if (_token) {
-            PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "file", _state, tell(), "stmt* $");
+            PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "file", _state, tell(), "top_level_stmt* $");
             _res = ast::File ( std::move ( b ) );
-            PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "stmt* $");
+            PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "top_level_stmt* $");
             --_level;
             return _res;
         }
         }
         seek(_state);
-        PARSER_DBG_("%*c- %s[%zu-%zu]: %s failed!\n", _level, ' ', "file", _state, tell(), "stmt* $");
+        PARSER_DBG_("%*c- %s[%zu-%zu]: %s failed!\n", _level, ' ', "file", _state, tell(), "top_level_stmt* $");
     }
     PARSER_DBG_("Fail at %zu: %s\n", _state, "file");
     --_level;
     return std::nullopt;
 }
 
+// top_level_stmt: stmt
+std::optional<ast::field<ast::stmt>> Parser::parse_top_level_stmt_rule()
+{
+    if (++_level > MAX_RECURSION_LEVEL) {
+        throw SyntaxError("Recursion limit exceeded");
+    }
+    const auto _state = tell();
+    (void)_state;
+    PARSER_PROFILE_(top_level_stmt);
+    std::optional<ast::field<ast::stmt>> _res = std::nullopt;
+    { // stmt
+        PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "top_level_stmt", _state, tell(), "stmt");
+        auto _user_opt_s = parse_stmt_rule();
+        if (_user_opt_s) { auto s = std::move(*_user_opt_s);
+            PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "top_level_stmt", _state, tell(), "stmt");
+            _res = _commit ( std::move ( s ) );
+            PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "stmt");
+            --_level;
+            return _res;
+        }
+        seek(_state);
+        PARSER_DBG_("%*c- %s[%zu-%zu]: %s failed!\n", _level, ' ', "top_level_stmt", _state, tell(), "stmt");
+    }
+    PARSER_DBG_("Fail at %zu: %s\n", _state, "top_level_stmt");
+    --_level;
+    return std::nullopt;
+}
+
 // stmt: cartridge_header_stmt | assign_stmt | expr_stmt | pass_stmt
 std::optional<ast::field<ast::stmt>> Parser::parse_stmt_rule()
 {
@@ -81,6 +117,7 @@ std::optional<ast::field<ast::stmt>> Parser::parse_stmt_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(stmt);
     if (auto _cached = get_cached<RuleType::stmt>(_state)) {
         --_level;
         return *_cached;
@@ -156,14 +193,15 @@ std::optional<ast::field<ast::stmt>> Parser::parse_cartridge_header_stmt_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(cartridge_header_stmt);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     { // 'cartridge' name ';'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "cartridge_header_stmt", _state, tell(), "'cartridge' name ';'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::CARTRIDGE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::CARTRIDGE);
         if (_keyword) {
         auto _user_opt_n = parse_name_rule();
         if (_user_opt_n) { auto n = std::move(*_user_opt_n);
-        auto _literal = lexer.expect().punct(lex::Punct::SEMI);
+        auto _literal = lexer.expect().accept(lex::Punct::SEMI);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "cartridge_header_stmt", _state, tell(), "'cartridge' name ';'");
             _res = ast::CartridgeHeader ( std::move ( n ) );
@@ -189,6 +227,7 @@ std::optional<ast::field<ast::stmt>> Parser::parse_assign_stmt_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(assign_stmt);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     { // expr assign_op expr ';'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_stmt", _state, tell(), "expr assign_op expr ';'");
@@ -198,7 +237,7 @@ std::optional<ast::field<ast::stmt>> Parser::parse_assign_stmt_rule()
         if (_user_opt_op) { auto op = std::move(*_user_opt_op);
         auto _user_opt_b = parse_expr_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
-        auto _literal = lexer.expect().punct(lex::Punct::SEMI);
+        auto _literal = lexer.expect().accept(lex::Punct::SEMI);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_stmt", _state, tell(), "expr assign_op expr ';'");
             _res = ast::Assign ( std::move ( a ) , std::move ( b ) , std::move ( op ) );
@@ -218,20 +257,21 @@ std::optional<ast::field<ast::stmt>> Parser::parse_assign_stmt_rule()
 }
 
 // assign_op: '=' | '+=' | '-=' | '*=' | '/=' | '%=' | '<<=' | '>>=' | '&=' | '|=' | '^='
-std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
+std::optional<ast::assign_op> Parser::parse_assign_op_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::assign_op>> _res = std::nullopt;
+    PARSER_PROFILE_(assign_op);
+    std::optional<ast::assign_op> _res = std::nullopt;
     { // '='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'='");
-        auto _literal = lexer.expect().punct(lex::Punct::EQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::EQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'='");
-            _res = ast::AsgnNone ( );
+            _res = ast::assign_op::AsgnNone;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'='");
             --_level;
             return _res;
@@ -241,10 +281,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '+='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'+='");
-        auto _literal = lexer.expect().punct(lex::Punct::PLUSEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::PLUSEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'+='");
-            _res = ast::AsgnAdd ( );
+            _res = ast::assign_op::AsgnAdd;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'+='");
             --_level;
             return _res;
@@ -254,10 +294,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '-='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'-='");
-        auto _literal = lexer.expect().punct(lex::Punct::MINEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::MINEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'-='");
-            _res = ast::AsgnSub ( );
+            _res = ast::assign_op::AsgnSub;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'-='");
             --_level;
             return _res;
@@ -267,10 +307,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '*='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'*='");
-        auto _literal = lexer.expect().punct(lex::Punct::STAREQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::STAREQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'*='");
-            _res = ast::AsgnMul ( );
+            _res = ast::assign_op::AsgnMul;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'*='");
             --_level;
             return _res;
@@ -280,10 +320,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '/='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'/='");
-        auto _literal = lexer.expect().punct(lex::Punct::SLASHEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::SLASHEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'/='");
-            _res = ast::AsgnDiv ( );
+            _res = ast::assign_op::AsgnDiv;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'/='");
             --_level;
             return _res;
@@ -293,10 +333,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '%='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'%='");
-        auto _literal = lexer.expect().punct(lex::Punct::PERCENTEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::PERCENTEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'%='");
-            _res = ast::AsgnMod ( );
+            _res = ast::assign_op::AsgnMod;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'%='");
             --_level;
             return _res;
@@ -306,10 +346,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '<<='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'<<='");
-        auto _literal = lexer.expect().punct(lex::Punct::LEFTSHIFTEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::LEFTSHIFTEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'<<='");
-            _res = ast::AsgnLShift ( );
+            _res = ast::assign_op::AsgnLShift;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'<<='");
             --_level;
             return _res;
@@ -319,10 +359,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '>>='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'>>='");
-        auto _literal = lexer.expect().punct(lex::Punct::RIGHTSHIFTEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::RIGHTSHIFTEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'>>='");
-            _res = ast::AsgnRShift ( );
+            _res = ast::assign_op::AsgnRShift;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'>>='");
             --_level;
             return _res;
@@ -332,10 +372,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '&='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'&='");
-        auto _literal = lexer.expect().punct(lex::Punct::AMPEREQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::AMPEREQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'&='");
-            _res = ast::AsgnBitAnd ( );
+            _res = ast::assign_op::AsgnBitAnd;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'&='");
             --_level;
             return _res;
@@ -345,10 +385,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '|='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'|='");
-        auto _literal = lexer.expect().punct(lex::Punct::VBAREQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::VBAREQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'|='");
-            _res = ast::AsgnBitOr ( );
+            _res = ast::assign_op::AsgnBitOr;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'|='");
             --_level;
             return _res;
@@ -358,10 +398,10 @@ std::optional<ast::field<ast::assign_op>> Parser::parse_assign_op_rule()
     }
     { // '^='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "assign_op", _state, tell(), "'^='");
-        auto _literal = lexer.expect().punct(lex::Punct::CIRCUMFLEXEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::CIRCUMFLEXEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "assign_op", _state, tell(), "'^='");
-            _res = ast::AsgnBitXor ( );
+            _res = ast::assign_op::AsgnBitXor;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'^='");
             --_level;
             return _res;
@@ -382,12 +422,13 @@ std::optional<ast::field<ast::stmt>> Parser::parse_expr_stmt_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_stmt);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     { // expr ';'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expr_stmt", _state, tell(), "expr ';'");
         auto _user_opt_a = parse_expr_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::SEMI);
+        auto _literal = lexer.expect().accept(lex::Punct::SEMI);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "expr_stmt", _state, tell(), "expr ';'");
             _res = ast::Expr ( std::move ( a ) );
@@ -412,10 +453,11 @@ std::optional<ast::field<ast::stmt>> Parser::parse_pass_stmt_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(pass_stmt);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     { // ';'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "pass_stmt", _state, tell(), "';'");
-        auto _literal = lexer.expect().punct(lex::Punct::SEMI);
+        auto _literal = lexer.expect().accept(lex::Punct::SEMI);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "pass_stmt", _state, tell(), "';'");
             _res = ast::Pass ( );
@@ -439,6 +481,7 @@ std::optional<ast::field<ast::defn>> Parser::parse_defn_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(defn);
     if (auto _cached = get_cached<RuleType::defn>(_state)) {
         --_level;
         return *_cached;
@@ -475,6 +518,7 @@ std::optional<ast::field<ast::defn>> Parser::parse_raw_defn_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(raw_defn);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // var_def
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "raw_defn", _state, tell(), "var_def");
@@ -554,10 +598,11 @@ std::optional<ast::field<ast::defn>> Parser::parse_var_def_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(var_def);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // 'var' name type_annotation? ['=' expr] ';'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "var_def", _state, tell(), "'var' name type_annotation? ['=' expr] ';'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::VAR);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::VAR);
         if (_keyword) {
         auto _user_opt_n = parse_name_rule();
         if (_user_opt_n) { auto n = std::move(*_user_opt_n);
@@ -565,7 +610,7 @@ std::optional<ast::field<ast::defn>> Parser::parse_var_def_rule()
         if (true) { auto t = _user_opt_t;
         auto _user_opt_v = parse__tmp_2_rule();
         if (true) { auto v = _user_opt_v;
-        auto _literal = lexer.expect().punct(lex::Punct::SEMI);
+        auto _literal = lexer.expect().accept(lex::Punct::SEMI);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "var_def", _state, tell(), "'var' name type_annotation? ['=' expr] ';'");
             _res = ast::VarDef ( std::move ( n ) , _opt2maybe ( std::move ( t ) ) , _opt2maybe ( std::move ( v ) ) , true );
@@ -593,18 +638,19 @@ std::optional<ast::field<ast::defn>> Parser::parse_func_def_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(func_def);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // 'func' name? '(' args_spec ')' type_annotation? func_body
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "func_def", _state, tell(), "'func' name? '(' args_spec ')' type_annotation? func_body");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::FUNC);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::FUNC);
         if (_keyword) {
         auto _user_opt_n = parse_name_rule();
         if (true) { auto n = _user_opt_n;
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
         auto _user_opt_a = parse_args_spec_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal_1) {
         auto _user_opt_t = parse_type_annotation_rule();
         if (true) { auto t = _user_opt_t;
@@ -638,10 +684,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_func_body_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(func_body);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '=>' expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "func_body", _state, tell(), "'=>' expr");
-        auto _literal = lexer.expect().punct(lex::Punct::RARROW2);
+        auto _literal = lexer.expect().accept(lex::Punct::RARROW2);
         if (_literal) {
         auto _single_result = parse_expr_rule();
         if (_single_result) {
@@ -681,10 +728,11 @@ std::optional<ast::field<ast::defn>> Parser::parse_impl_def_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(impl_def);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // 'impl' expr defn_block
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "impl_def", _state, tell(), "'impl' expr defn_block");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::IMPL);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::IMPL);
         if (_keyword) {
         auto _user_opt_c = parse_expr_rule();
         if (_user_opt_c) { auto c = std::move(*_user_opt_c);
@@ -703,11 +751,11 @@ std::optional<ast::field<ast::defn>> Parser::parse_impl_def_rule()
     }
     { // 'impl' expr 'for' expr defn_block
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "impl_def", _state, tell(), "'impl' expr 'for' expr defn_block");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::IMPL);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::IMPL);
         if (_keyword) {
         auto _user_opt_t = parse_expr_rule();
         if (_user_opt_t) { auto t = std::move(*_user_opt_t);
-        auto _keyword_1 = lexer.expect().keyword(lex::HardKeyword::FOR);
+        auto _keyword_1 = lexer.expect().accept(lex::HardKeyword::FOR);
         if (_keyword_1) {
         auto _user_opt_c = parse_expr_rule();
         if (_user_opt_c) { auto c = std::move(*_user_opt_c);
@@ -739,14 +787,15 @@ std::optional<ast::sequence < ast::stmt >> Parser::parse_defn_block_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(defn_block);
     std::optional<ast::sequence < ast::stmt >> _res = std::nullopt;
     { // '{' stmt* '}'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "defn_block", _state, tell(), "'{' stmt* '}'");
-        auto _literal = lexer.expect().punct(lex::Punct::LBRACE);
+        auto _literal = lexer.expect().accept(lex::Punct::LBRACE);
         if (_literal) {
         auto _single_result = parse__loop0_3_rule();
         if (_single_result) {
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RBRACE);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RBRACE);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "defn_block", _state, tell(), "'{' stmt* '}'");
             _res = std::move(_single_result);
@@ -772,6 +821,7 @@ std::optional<ast::field<ast::defn>> Parser::parse_struct_def_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(struct_def);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // ('class' | 'struct') name? args_spec
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "struct_def", _state, tell(), "('class' | 'struct') name? args_spec");
@@ -805,10 +855,11 @@ std::optional<ast::field<ast::defn>> Parser::parse_ns_def_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(ns_def);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // 'ns' ns_spec
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "ns_def", _state, tell(), "'ns' ns_spec");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::NAMESPACE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::NAMESPACE);
         if (_keyword) {
         auto _single_result = parse_ns_spec_rule();
         if (_single_result) {
@@ -835,12 +886,13 @@ std::optional<ast::field<ast::defn>> Parser::parse_ns_spec_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(ns_spec);
     std::optional<ast::field<ast::defn>> _res = std::nullopt;
     { // 'cartridge' '::' ns_spec_raw
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "ns_spec", _state, tell(), "'cartridge' '::' ns_spec_raw");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::CARTRIDGE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::CARTRIDGE);
         if (_keyword) {
-        auto _literal = lexer.expect().punct(lex::Punct::DOUBLECOLON);
+        auto _literal = lexer.expect().accept(lex::Punct::DOUBLECOLON);
         if (_literal) {
         auto _user_opt_a = parse_ns_spec_raw_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -881,6 +933,7 @@ std::optional<ast::sequence < ast::identifier >> Parser::parse_ns_spec_raw_rule(
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(ns_spec_raw);
     std::optional<ast::sequence < ast::identifier >> _res = std::nullopt;
     { // '::'.name+
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "ns_spec_raw", _state, tell(), "'::'.name+");
@@ -908,12 +961,13 @@ std::optional<ast::field<ast::args_spec>> Parser::parse_args_spec_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(args_spec);
     std::optional<ast::field<ast::args_spec>> _res = std::nullopt;
     { // args_spec_nonempty ','?
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "args_spec", _state, tell(), "args_spec_nonempty ','?");
         auto _user_opt_a = parse_args_spec_nonempty_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _opt_var = lexer.expect().punct(lex::Punct::COMMA);
+        auto _opt_var = lexer.expect().accept(lex::Punct::COMMA);
         if (true) { (void)_opt_var;
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "args_spec", _state, tell(), "args_spec_nonempty ','?");
             _res = std::move ( a );
@@ -947,10 +1001,11 @@ std::optional<ast::field<ast::args_spec>> Parser::parse_args_spec_nonempty_rule(
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(args_spec_nonempty);
     std::optional<ast::field<ast::args_spec>> _res = std::nullopt;
     { // "self" ((',' arg_spec))*
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "args_spec_nonempty", _state, tell(), "\"self\" ((',' arg_spec))*");
-        auto _keyword = lexer.expect().soft_keyword("self");
+        auto _keyword = lexer.expect().accept_soft_keyword("self");
         if (_keyword) {
         auto _user_opt_a = parse__loop0_7_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -990,6 +1045,7 @@ std::optional<ast::field<ast::arg_spec>> Parser::parse_arg_spec_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(arg_spec);
     std::optional<ast::field<ast::arg_spec>> _res = std::nullopt;
     { // name type_annotation [('=' expr)]
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "arg_spec", _state, tell(), "name type_annotation [('=' expr)]");
@@ -1023,6 +1079,7 @@ std::optional<ast::field<ast::flow>> Parser::parse_flow_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(flow);
     if (auto _cached = get_cached<RuleType::flow>(_state)) {
         --_level;
         return *_cached;
@@ -1030,7 +1087,7 @@ std::optional<ast::field<ast::flow>> Parser::parse_flow_rule()
     std::optional<ast::field<ast::flow>> _res = std::nullopt;
     { // 'unwrap' raw_flow
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "flow", _state, tell(), "'unwrap' raw_flow");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::UNWRAP);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::UNWRAP);
         if (_keyword) {
         auto _user_opt_a = parse_raw_flow_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -1073,6 +1130,7 @@ std::optional<ast::field<ast::flow>> Parser::parse_raw_flow_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(raw_flow);
     std::optional<ast::field<ast::flow>> _res = std::nullopt;
     { // if_flow
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "raw_flow", _state, tell(), "if_flow");
@@ -1139,10 +1197,11 @@ std::optional<ast::field<ast::flow>> Parser::parse_if_flow_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(if_flow);
     std::optional<ast::field<ast::flow>> _res = std::nullopt;
     { // 'if' expr flow_block [('else' flow_block)]
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "if_flow", _state, tell(), "'if' expr flow_block [('else' flow_block)]");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::IF);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::IF);
         if (_keyword) {
         auto _user_opt_c = parse_expr_rule();
         if (_user_opt_c) { auto c = std::move(*_user_opt_c);
@@ -1175,14 +1234,15 @@ std::optional<ast::field<ast::flow>> Parser::parse_for_flow_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(for_flow);
     std::optional<ast::field<ast::flow>> _res = std::nullopt;
     { // 'for' name 'in' expr flow_block [('else' flow_block)]
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "for_flow", _state, tell(), "'for' name 'in' expr flow_block [('else' flow_block)]");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::FOR);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::FOR);
         if (_keyword) {
         auto _user_opt_v = parse_name_rule();
         if (_user_opt_v) { auto v = std::move(*_user_opt_v);
-        auto _keyword_1 = lexer.expect().keyword(lex::HardKeyword::IN);
+        auto _keyword_1 = lexer.expect().accept(lex::HardKeyword::IN);
         if (_keyword_1) {
         auto _user_opt_s = parse_expr_rule();
         if (_user_opt_s) { auto s = std::move(*_user_opt_s);
@@ -1217,10 +1277,11 @@ std::optional<ast::field<ast::flow>> Parser::parse_while_flow_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(while_flow);
     std::optional<ast::field<ast::flow>> _res = std::nullopt;
     { // 'while' expr flow_block [('else' flow_block)]
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "while_flow", _state, tell(), "'while' expr flow_block [('else' flow_block)]");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::WHILE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::WHILE);
         if (_keyword) {
         auto _user_opt_c = parse_expr_rule();
         if (_user_opt_c) { auto c = std::move(*_user_opt_c);
@@ -1253,10 +1314,11 @@ std::optional<ast::field<ast::flow>> Parser::parse_loop_flow_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(loop_flow);
     std::optional<ast::field<ast::flow>> _res = std::nullopt;
     { // 'loop' flow_block
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "loop_flow", _state, tell(), "'loop' flow_block");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::LOOP);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::LOOP);
         if (_keyword) {
         auto _user_opt_b = parse_flow_block_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
@@ -1283,6 +1345,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_flow_block_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(flow_block);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // block_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "flow_block", _state, tell(), "block_expr");
@@ -1336,6 +1399,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_or_unit_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_or_unit);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expr_or_unit", _state, tell(), "expr");
@@ -1372,6 +1436,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr);
     if (auto _cached = get_cached<RuleType::expr>(_state)) {
         --_level;
         return *_cached;
@@ -1433,6 +1498,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_defn_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(defn_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // defn
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "defn_expr", _state, tell(), "defn");
@@ -1460,6 +1526,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_flow_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(flow_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // flow
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "flow_expr", _state, tell(), "flow");
@@ -1487,6 +1554,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_0_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_0);
     if (auto _cached = get_cached<RuleType::expr_0>(_state)) {
         --_level;
         return *_cached;
@@ -1548,6 +1616,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_and_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(and_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_2 (('and' expr_1))+
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "and_expr", _state, tell(), "expr_2 (('and' expr_1))+");
@@ -1556,7 +1625,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_and_expr_rule()
         auto _user_opt_b = parse__loop1_14_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "and_expr", _state, tell(), "expr_2 (('and' expr_1))+");
-            _res = ast::BoolOp ( ast::And ( ) , _prepend1 ( a , b ) );
+            _res = ast::BoolOp ( ast::bool_op::And , _prepend1 ( a , b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "expr_2 (('and' expr_1))+");
             --_level;
             return _res;
@@ -1578,6 +1647,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_or_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(or_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_2 (('or' expr_1))+
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "or_expr", _state, tell(), "expr_2 (('or' expr_1))+");
@@ -1586,7 +1656,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_or_expr_rule()
         auto _user_opt_b = parse__loop1_15_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "or_expr", _state, tell(), "expr_2 (('or' expr_1))+");
-            _res = ast::BoolOp ( ast::Or ( ) , _prepend1 ( a , b ) );
+            _res = ast::BoolOp ( ast::bool_op::Or , _prepend1 ( a , b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "expr_2 (('or' expr_1))+");
             --_level;
             return _res;
@@ -1608,6 +1678,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_1_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_1);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // not_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expr_1", _state, tell(), "not_expr");
@@ -1687,15 +1758,16 @@ std::optional<ast::field<ast::expr>> Parser::parse_not_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(not_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'not' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "not_expr", _state, tell(), "'not' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::NOT);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::NOT);
         if (_keyword) {
         auto _user_opt_a = parse_expr_1_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "not_expr", _state, tell(), "'not' expr_1");
-            _res = ast::UnOp ( ast::Not ( ) , std::move ( a ) );
+            _res = ast::UnOp ( ast::unary_op::Not , std::move ( a ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'not' expr_1");
             --_level;
             return _res;
@@ -1717,10 +1789,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_expand_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expand_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'expand' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expand_expr", _state, tell(), "'expand' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::EXPAND);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::EXPAND);
         if (_keyword) {
         auto _user_opt_a = parse_expr_1_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -1747,15 +1820,16 @@ std::optional<ast::field<ast::expr>> Parser::parse_pass_spec_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(pass_spec_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'ref' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "pass_spec_expr", _state, tell(), "'ref' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::REF);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::REF);
         if (_keyword) {
         auto _user_opt_a = parse_expr_1_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "pass_spec_expr", _state, tell(), "'ref' expr_1");
-            _res = ast::PassSpec ( ast::ByRef ( ) , std::move ( a ) );
+            _res = ast::PassSpec ( ast::pass_kind::ByRef , std::move ( a ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'ref' expr_1");
             --_level;
             return _res;
@@ -1766,12 +1840,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_pass_spec_expr_rule()
     }
     { // 'move' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "pass_spec_expr", _state, tell(), "'move' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::MOVE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::MOVE);
         if (_keyword) {
         auto _user_opt_a = parse_expr_1_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "pass_spec_expr", _state, tell(), "'move' expr_1");
-            _res = ast::PassSpec ( ast::ByMove ( ) , std::move ( a ) );
+            _res = ast::PassSpec ( ast::pass_kind::ByMove , std::move ( a ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'move' expr_1");
             --_level;
             return _res;
@@ -1782,12 +1856,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_pass_spec_expr_rule()
     }
     { // 'copy' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "pass_spec_expr", _state, tell(), "'copy' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::COPY);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::COPY);
         if (_keyword) {
         auto _user_opt_a = parse_expr_1_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "pass_spec_expr", _state, tell(), "'copy' expr_1");
-            _res = ast::PassSpec ( ast::ByCopy ( ) , std::move ( a ) );
+            _res = ast::PassSpec ( ast::pass_kind::ByCopy , std::move ( a ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'copy' expr_1");
             --_level;
             return _res;
@@ -1809,6 +1883,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_flow_control_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(flow_control_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // return_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "flow_control_expr", _state, tell(), "return_expr");
@@ -1862,10 +1937,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_return_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(return_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'return' expr_or_unit
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "return_expr", _state, tell(), "'return' expr_or_unit");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::RETURN);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::RETURN);
         if (_keyword) {
         auto _user_opt_a = parse_expr_or_unit_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -1892,10 +1968,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_break_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(break_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'break' expr_or_unit
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "break_expr", _state, tell(), "'break' expr_or_unit");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::BREAK);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::BREAK);
         if (_keyword) {
         auto _user_opt_a = parse_expr_or_unit_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -1922,10 +1999,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_continue_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(continue_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'continue'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "continue_expr", _state, tell(), "'continue'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::CONTINUE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::CONTINUE);
         if (_keyword) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "continue_expr", _state, tell(), "'continue'");
             _res = ast::Continue ( );
@@ -1949,6 +2027,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_2_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_2);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // comparison_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expr_2", _state, tell(), "comparison_expr");
@@ -2002,6 +2081,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_comparison_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(comparison_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_3 comparison_followup_pair+
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_expr", _state, tell(), "expr_3 comparison_followup_pair+");
@@ -2025,14 +2105,15 @@ std::optional<ast::field<ast::expr>> Parser::parse_comparison_expr_rule()
 }
 
 // comparison_followup_pair: comparison_op expr_3
-std::optional<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>> Parser::parse_comparison_followup_pair_rule()
+std::optional<std::pair < ast::cmp_op , ast::field < ast::expr >>> Parser::parse_comparison_followup_pair_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>> _res = std::nullopt;
+    PARSER_PROFILE_(comparison_followup_pair);
+    std::optional<std::pair < ast::cmp_op , ast::field < ast::expr >>> _res = std::nullopt;
     { // comparison_op expr_3
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_followup_pair", _state, tell(), "comparison_op expr_3");
         auto _user_opt_o = parse_comparison_op_rule();
@@ -2055,20 +2136,21 @@ std::optional<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>
 }
 
 // comparison_op: '==' | '!=' | '<' | '<=' | '>' | '>=' | 'in' | 'not' 'in'
-std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
+std::optional<ast::cmp_op> Parser::parse_comparison_op_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::cmp_op>> _res = std::nullopt;
+    PARSER_PROFILE_(comparison_op);
+    std::optional<ast::cmp_op> _res = std::nullopt;
     { // '=='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'=='");
-        auto _literal = lexer.expect().punct(lex::Punct::DOUBLEEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::DOUBLEEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'=='");
-            _res = ast::Eq ( );
+            _res = ast::cmp_op::Eq;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'=='");
             --_level;
             return _res;
@@ -2078,10 +2160,10 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // '!='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'!='");
-        auto _literal = lexer.expect().punct(lex::Punct::NOTEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::NOTEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'!='");
-            _res = ast::NotEq ( );
+            _res = ast::cmp_op::NotEq;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'!='");
             --_level;
             return _res;
@@ -2091,10 +2173,10 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // '<'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'<'");
-        auto _literal = lexer.expect().punct(lex::Punct::LESS);
+        auto _literal = lexer.expect().accept(lex::Punct::LESS);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'<'");
-            _res = ast::Lt ( );
+            _res = ast::cmp_op::Lt;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'<'");
             --_level;
             return _res;
@@ -2104,10 +2186,10 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // '<='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'<='");
-        auto _literal = lexer.expect().punct(lex::Punct::LESSEQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::LESSEQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'<='");
-            _res = ast::LtE ( );
+            _res = ast::cmp_op::LtE;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'<='");
             --_level;
             return _res;
@@ -2117,10 +2199,10 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // '>'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'>'");
-        auto _literal = lexer.expect().punct(lex::Punct::GREATER);
+        auto _literal = lexer.expect().accept(lex::Punct::GREATER);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'>'");
-            _res = ast::Gt ( );
+            _res = ast::cmp_op::Gt;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'>'");
             --_level;
             return _res;
@@ -2130,10 +2212,10 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // '>='
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'>='");
-        auto _literal = lexer.expect().punct(lex::Punct::GREATEREQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::GREATEREQUAL);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'>='");
-            _res = ast::GtE ( );
+            _res = ast::cmp_op::GtE;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'>='");
             --_level;
             return _res;
@@ -2143,10 +2225,10 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // 'in'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'in'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::IN);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::IN);
         if (_keyword) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'in'");
-            _res = ast::In ( );
+            _res = ast::cmp_op::In;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'in'");
             --_level;
             return _res;
@@ -2156,12 +2238,12 @@ std::optional<ast::field<ast::cmp_op>> Parser::parse_comparison_op_rule()
     }
     { // 'not' 'in'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "comparison_op", _state, tell(), "'not' 'in'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::NOT);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::NOT);
         if (_keyword) {
-        auto _keyword_1 = lexer.expect().keyword(lex::HardKeyword::IN);
+        auto _keyword_1 = lexer.expect().accept(lex::HardKeyword::IN);
         if (_keyword_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "comparison_op", _state, tell(), "'not' 'in'");
-            _res = ast::NotIn ( );
+            _res = ast::cmp_op::NotIn;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'not' 'in'");
             --_level;
             return _res;
@@ -2183,17 +2265,18 @@ std::optional<ast::field<ast::expr>> Parser::parse_bidir_cmp_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(bidir_cmp_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_3 '<=>' expr_3
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "bidir_cmp_expr", _state, tell(), "expr_3 '<=>' expr_3");
         auto _user_opt_a = parse_expr_3_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::BIDIRCMP);
+        auto _literal = lexer.expect().accept(lex::Punct::BIDIRCMP);
         if (_literal) {
         auto _user_opt_b = parse_expr_3_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "bidir_cmp_expr", _state, tell(), "expr_3 '<=>' expr_3");
-            _res = ast::BinOp ( ast::BidirCmp ( ) , std::move ( a ) , std::move ( b ) );
+            _res = ast::BinOp ( ast::binary_op::BidirCmp , std::move ( a ) , std::move ( b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "expr_3 '<=>' expr_3");
             --_level;
             return _res;
@@ -2216,6 +2299,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_3_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_3);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // arithm_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expr_3", _state, tell(), "arithm_expr");
@@ -2269,6 +2353,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_arithm_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(arithm_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // sum_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "arithm_expr", _state, tell(), "sum_expr");
@@ -2323,6 +2408,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_sum_expr_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(sum_expr);
     if (auto _cached = get_cached<RuleType::sum_expr>(_state)) {
         --_level;
         return *_cached;
@@ -2377,20 +2463,21 @@ std::optional<ast::field<ast::expr>> Parser::parse_raw_sum_expr()
 }
 
 // sum_bin_op: '+' | '-'
-std::optional<ast::field<ast::binary_op>> Parser::parse_sum_bin_op_rule()
+std::optional<ast::binary_op> Parser::parse_sum_bin_op_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::binary_op>> _res = std::nullopt;
+    PARSER_PROFILE_(sum_bin_op);
+    std::optional<ast::binary_op> _res = std::nullopt;
     { // '+'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "sum_bin_op", _state, tell(), "'+'");
-        auto _literal = lexer.expect().punct(lex::Punct::PLUS);
+        auto _literal = lexer.expect().accept(lex::Punct::PLUS);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "sum_bin_op", _state, tell(), "'+'");
-            _res = ast::Add ( );
+            _res = ast::binary_op::Add;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'+'");
             --_level;
             return _res;
@@ -2400,10 +2487,10 @@ std::optional<ast::field<ast::binary_op>> Parser::parse_sum_bin_op_rule()
     }
     { // '-'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "sum_bin_op", _state, tell(), "'-'");
-        auto _literal = lexer.expect().punct(lex::Punct::MINUS);
+        auto _literal = lexer.expect().accept(lex::Punct::MINUS);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "sum_bin_op", _state, tell(), "'-'");
-            _res = ast::Sub ( );
+            _res = ast::binary_op::Sub;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'-'");
             --_level;
             return _res;
@@ -2425,6 +2512,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_product_expr_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(product_expr);
     if (auto _cached = get_cached<RuleType::product_expr>(_state)) {
         --_level;
         return *_cached;
@@ -2479,20 +2567,21 @@ std::optional<ast::field<ast::expr>> Parser::parse_raw_product_expr()
 }
 
 // product_bin_op: '*' | '/'
-std::optional<ast::field<ast::binary_op>> Parser::parse_product_bin_op_rule()
+std::optional<ast::binary_op> Parser::parse_product_bin_op_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::binary_op>> _res = std::nullopt;
+    PARSER_PROFILE_(product_bin_op);
+    std::optional<ast::binary_op> _res = std::nullopt;
     { // '*'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "product_bin_op", _state, tell(), "'*'");
-        auto _literal = lexer.expect().punct(lex::Punct::STAR);
+        auto _literal = lexer.expect().accept(lex::Punct::STAR);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "product_bin_op", _state, tell(), "'*'");
-            _res = ast::Mul ( );
+            _res = ast::binary_op::Mul;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'*'");
             --_level;
             return _res;
@@ -2502,10 +2591,10 @@ std::optional<ast::field<ast::binary_op>> Parser::parse_product_bin_op_rule()
     }
     { // '/'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "product_bin_op", _state, tell(), "'/'");
-        auto _literal = lexer.expect().punct(lex::Punct::SLASH);
+        auto _literal = lexer.expect().accept(lex::Punct::SLASH);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "product_bin_op", _state, tell(), "'/'");
-            _res = ast::Div ( );
+            _res = ast::binary_op::Div;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'/'");
             --_level;
             return _res;
@@ -2526,17 +2615,18 @@ std::optional<ast::field<ast::expr>> Parser::parse_modulo_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(modulo_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_4 '%' expr_4
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "modulo_expr", _state, tell(), "expr_4 '%' expr_4");
         auto _user_opt_a = parse_expr_4_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::PERCENT);
+        auto _literal = lexer.expect().accept(lex::Punct::PERCENT);
         if (_literal) {
         auto _user_opt_b = parse_expr_4_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "modulo_expr", _state, tell(), "expr_4 '%' expr_4");
-            _res = ast::BinOp ( ast::Mod ( ) , std::move ( a ) , std::move ( b ) );
+            _res = ast::BinOp ( ast::binary_op::Mod , std::move ( a ) , std::move ( b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "expr_4 '%' expr_4");
             --_level;
             return _res;
@@ -2559,6 +2649,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_bitwise_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(bitwise_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // bitor_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "bitwise_expr", _state, tell(), "bitor_expr");
@@ -2626,6 +2717,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_bitor_expr_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(bitor_expr);
     if (auto _cached = get_cached<RuleType::bitor_expr>(_state)) {
         --_level;
         return *_cached;
@@ -2659,12 +2751,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_raw_bitor_expr()
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "bitor_expr", _state, tell(), "(bitor_expr | expr_4) '|' expr_4");
         auto _user_opt_a = parse__tmp_19_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::VBAR);
+        auto _literal = lexer.expect().accept(lex::Punct::VBAR);
         if (_literal) {
         auto _user_opt_b = parse_expr_4_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "bitor_expr", _state, tell(), "(bitor_expr | expr_4) '|' expr_4");
-            _res = ast::BinOp ( ast::BitOr ( ) , std::move ( a ) , std::move ( b ) );
+            _res = ast::BinOp ( ast::binary_op::BitOr , std::move ( a ) , std::move ( b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "(bitor_expr | expr_4) '|' expr_4");
             --_level;
             return _res;
@@ -2688,6 +2780,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_bitand_expr_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(bitand_expr);
     if (auto _cached = get_cached<RuleType::bitand_expr>(_state)) {
         --_level;
         return *_cached;
@@ -2721,12 +2814,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_raw_bitand_expr()
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "bitand_expr", _state, tell(), "(bitand_expr | expr_4) '&' expr_4");
         auto _user_opt_a = parse__tmp_20_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::AMPER);
+        auto _literal = lexer.expect().accept(lex::Punct::AMPER);
         if (_literal) {
         auto _user_opt_b = parse_expr_4_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "bitand_expr", _state, tell(), "(bitand_expr | expr_4) '&' expr_4");
-            _res = ast::BinOp ( ast::BitAnd ( ) , std::move ( a ) , std::move ( b ) );
+            _res = ast::BinOp ( ast::binary_op::BitAnd , std::move ( a ) , std::move ( b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "(bitand_expr | expr_4) '&' expr_4");
             --_level;
             return _res;
@@ -2750,6 +2843,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_bitxor_expr_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(bitxor_expr);
     if (auto _cached = get_cached<RuleType::bitxor_expr>(_state)) {
         --_level;
         return *_cached;
@@ -2783,12 +2877,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_raw_bitxor_expr()
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "bitxor_expr", _state, tell(), "(bitxor_expr | expr_4) '^' expr_4");
         auto _user_opt_a = parse__tmp_21_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::CIRCUMFLEX);
+        auto _literal = lexer.expect().accept(lex::Punct::CIRCUMFLEX);
         if (_literal) {
         auto _user_opt_b = parse_expr_4_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "bitxor_expr", _state, tell(), "(bitxor_expr | expr_4) '^' expr_4");
-            _res = ast::BinOp ( ast::BitXor ( ) , std::move ( a ) , std::move ( b ) );
+            _res = ast::BinOp ( ast::binary_op::BitXor , std::move ( a ) , std::move ( b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "(bitxor_expr | expr_4) '^' expr_4");
             --_level;
             return _res;
@@ -2812,6 +2906,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_shift_expr_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(shift_expr);
     if (auto _cached = get_cached<RuleType::shift_expr>(_state)) {
         --_level;
         return *_cached;
@@ -2866,20 +2961,21 @@ std::optional<ast::field<ast::expr>> Parser::parse_raw_shift_expr()
 }
 
 // shift_bin_op: '<<' | '>>'
-std::optional<ast::field<ast::binary_op>> Parser::parse_shift_bin_op_rule()
+std::optional<ast::binary_op> Parser::parse_shift_bin_op_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::binary_op>> _res = std::nullopt;
+    PARSER_PROFILE_(shift_bin_op);
+    std::optional<ast::binary_op> _res = std::nullopt;
     { // '<<'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "shift_bin_op", _state, tell(), "'<<'");
-        auto _literal = lexer.expect().punct(lex::Punct::LEFTSHIFT);
+        auto _literal = lexer.expect().accept(lex::Punct::LEFTSHIFT);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "shift_bin_op", _state, tell(), "'<<'");
-            _res = ast::LShift ( );
+            _res = ast::binary_op::LShift;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'<<'");
             --_level;
             return _res;
@@ -2889,10 +2985,10 @@ std::optional<ast::field<ast::binary_op>> Parser::parse_shift_bin_op_rule()
     }
     { // '>>'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "shift_bin_op", _state, tell(), "'>>'");
-        auto _literal = lexer.expect().punct(lex::Punct::RIGHTSHIFT);
+        auto _literal = lexer.expect().accept(lex::Punct::RIGHTSHIFT);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "shift_bin_op", _state, tell(), "'>>'");
-            _res = ast::RShift ( );
+            _res = ast::binary_op::RShift;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'>>'");
             --_level;
             return _res;
@@ -2913,6 +3009,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_4_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_4);
     if (auto _cached = get_cached<RuleType::expr_4>(_state)) {
         --_level;
         return *_cached;
@@ -2974,6 +3071,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_unary_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(unary_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // unary_op (unary_expr | expr_5)
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "unary_expr", _state, tell(), "unary_op (unary_expr | expr_5)");
@@ -2997,20 +3095,21 @@ std::optional<ast::field<ast::expr>> Parser::parse_unary_expr_rule()
 }
 
 // unary_op: '+' | '-' | '~' | '&' | '*'
-std::optional<ast::field<ast::unary_op>> Parser::parse_unary_op_rule()
+std::optional<ast::unary_op> Parser::parse_unary_op_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::unary_op>> _res = std::nullopt;
+    PARSER_PROFILE_(unary_op);
+    std::optional<ast::unary_op> _res = std::nullopt;
     { // '+'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "unary_op", _state, tell(), "'+'");
-        auto _literal = lexer.expect().punct(lex::Punct::PLUS);
+        auto _literal = lexer.expect().accept(lex::Punct::PLUS);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "unary_op", _state, tell(), "'+'");
-            _res = ast::UAdd ( );
+            _res = ast::unary_op::UAdd;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'+'");
             --_level;
             return _res;
@@ -3020,10 +3119,10 @@ std::optional<ast::field<ast::unary_op>> Parser::parse_unary_op_rule()
     }
     { // '-'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "unary_op", _state, tell(), "'-'");
-        auto _literal = lexer.expect().punct(lex::Punct::MINUS);
+        auto _literal = lexer.expect().accept(lex::Punct::MINUS);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "unary_op", _state, tell(), "'-'");
-            _res = ast::USub ( );
+            _res = ast::unary_op::USub;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'-'");
             --_level;
             return _res;
@@ -3033,10 +3132,10 @@ std::optional<ast::field<ast::unary_op>> Parser::parse_unary_op_rule()
     }
     { // '~'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "unary_op", _state, tell(), "'~'");
-        auto _literal = lexer.expect().punct(lex::Punct::TILDE);
+        auto _literal = lexer.expect().accept(lex::Punct::TILDE);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "unary_op", _state, tell(), "'~'");
-            _res = ast::BitInv ( );
+            _res = ast::unary_op::BitInv;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'~'");
             --_level;
             return _res;
@@ -3046,10 +3145,10 @@ std::optional<ast::field<ast::unary_op>> Parser::parse_unary_op_rule()
     }
     { // '&'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "unary_op", _state, tell(), "'&'");
-        auto _literal = lexer.expect().punct(lex::Punct::AMPER);
+        auto _literal = lexer.expect().accept(lex::Punct::AMPER);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "unary_op", _state, tell(), "'&'");
-            _res = ast::URef ( );
+            _res = ast::unary_op::URef;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'&'");
             --_level;
             return _res;
@@ -3059,10 +3158,10 @@ std::optional<ast::field<ast::unary_op>> Parser::parse_unary_op_rule()
     }
     { // '*'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "unary_op", _state, tell(), "'*'");
-        auto _literal = lexer.expect().punct(lex::Punct::STAR);
+        auto _literal = lexer.expect().accept(lex::Punct::STAR);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "unary_op", _state, tell(), "'*'");
-            _res = ast::UStar ( );
+            _res = ast::unary_op::UStar;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'*'");
             --_level;
             return _res;
@@ -3083,17 +3182,18 @@ std::optional<ast::field<ast::expr>> Parser::parse_power_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(power_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_5 '**' expr_5
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "power_expr", _state, tell(), "expr_5 '**' expr_5");
         auto _user_opt_a = parse_expr_5_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::POWER);
+        auto _literal = lexer.expect().accept(lex::Punct::POWER);
         if (_literal) {
         auto _user_opt_b = parse_expr_5_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "power_expr", _state, tell(), "expr_5 '**' expr_5");
-            _res = ast::BinOp ( ast::Pow ( ) , std::move ( a ) , std::move ( b ) );
+            _res = ast::BinOp ( ast::binary_op::Pow , std::move ( a ) , std::move ( b ) );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "expr_5 '**' expr_5");
             --_level;
             return _res;
@@ -3123,6 +3223,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_5_rule()
     }
     auto _state = tell();
     auto _res_state = tell();
+    PARSER_PROFILE_(expr_5);
     if (auto _cached = get_cached<RuleType::expr_5>(_state)) {
         --_level;
         return *_cached;
@@ -3244,12 +3345,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_dot_attr_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(dot_attr_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_5 '.' name
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "dot_attr_expr", _state, tell(), "expr_5 '.' name");
         auto _user_opt_a = parse_expr_5_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::DOT);
+        auto _literal = lexer.expect().accept(lex::Punct::DOT);
         if (_literal) {
         auto _user_opt_b = parse_name_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
@@ -3278,12 +3380,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_colon_attr_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(colon_attr_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_5 '::' name
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "colon_attr_expr", _state, tell(), "expr_5 '::' name");
         auto _user_opt_a = parse_expr_5_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::DOUBLECOLON);
+        auto _literal = lexer.expect().accept(lex::Punct::DOUBLECOLON);
         if (_literal) {
         auto _user_opt_b = parse_name_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
@@ -3312,16 +3415,17 @@ std::optional<ast::field<ast::expr>> Parser::parse_call_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(call_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_5 '(' call_args ')'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "call_expr", _state, tell(), "expr_5 '(' call_args ')'");
         auto _user_opt_a = parse_expr_5_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
         auto _user_opt_b = parse_call_args_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "call_expr", _state, tell(), "expr_5 '(' call_args ')'");
             _res = ast::Call ( std::move ( a ) , std::move ( b ) );
@@ -3349,12 +3453,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_macro_call_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(macro_call_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_5 '!' token_stream_delim
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "macro_call_expr", _state, tell(), "expr_5 '!' token_stream_delim");
         auto _user_opt_a = parse_expr_5_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::EXCLAMATION);
+        auto _literal = lexer.expect().accept(lex::Punct::EXCLAMATION);
         if (_literal) {
         auto _user_opt_b = parse_token_stream_delim_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
@@ -3383,16 +3488,17 @@ std::optional<ast::field<ast::expr>> Parser::parse_subscript_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(subscript_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_5 '[' call_args ']'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "subscript_expr", _state, tell(), "expr_5 '[' call_args ']'");
         auto _user_opt_a = parse_expr_5_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal = lexer.expect().punct(lex::Punct::LSQB);
+        auto _literal = lexer.expect().accept(lex::Punct::LSQB);
         if (_literal) {
         auto _user_opt_b = parse_call_args_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RSQB);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RSQB);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "subscript_expr", _state, tell(), "expr_5 '[' call_args ']'");
             _res = ast::Subscript ( std::move ( a ) , std::move ( b ) );
@@ -3419,6 +3525,7 @@ std::optional<ast::field<ast::call_args>> Parser::parse_call_args_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(call_args);
     if (auto _cached = get_cached<RuleType::call_args>(_state)) {
         --_level;
         return *_cached;
@@ -3427,7 +3534,7 @@ std::optional<ast::field<ast::call_args>> Parser::parse_call_args_rule()
     { // 
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "call_args", _state, tell(), "");
         PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "call_args", _state, tell(), "");
-        _res = ast::call_args ( ast::make_sequence < ast::call_arg > ( ) , nullptr , nullptr );
+        _res = ast::call_args ( ast::make_sequence < ast::call_arg > ( ) , std::nullopt , std::nullopt );
         PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "");
         --_level;
         store_cached<RuleType::call_args>(_state, _res);
@@ -3448,6 +3555,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_token_stream_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(token_stream);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // token_stream_delim
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "token_stream", _state, tell(), "token_stream_delim");
@@ -3491,16 +3599,17 @@ std::optional<ast::field<ast::expr>> Parser::parse_token_stream_delim_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(token_stream_delim);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '(' ~ token_stream* ')'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "token_stream_delim", _state, tell(), "'(' ~ token_stream* ')'");
         std::optional<std::monostate> _cut_var = std::nullopt;
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
         _cut_var = std::optional<std::monostate>(std::monostate{});
         auto _user_opt_a = parse__loop0_24_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "token_stream_delim", _state, tell(), "'(' ~ token_stream* ')'");
             _res = ast::TokenStream ( /* ? ? ? */ );
@@ -3520,12 +3629,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_token_stream_delim_rule()
     { // '[' ~ token_stream* ']'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "token_stream_delim", _state, tell(), "'[' ~ token_stream* ']'");
         std::optional<std::monostate> _cut_var = std::nullopt;
-        auto _literal = lexer.expect().punct(lex::Punct::LSQB);
+        auto _literal = lexer.expect().accept(lex::Punct::LSQB);
         if (_literal) {
         _cut_var = std::optional<std::monostate>(std::monostate{});
         auto _user_opt_a = parse__loop0_25_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RSQB);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RSQB);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "token_stream_delim", _state, tell(), "'[' ~ token_stream* ']'");
             _res = ast::TokenStream ( /* ? ? ? */ );
@@ -3545,12 +3654,12 @@ std::optional<ast::field<ast::expr>> Parser::parse_token_stream_delim_rule()
     { // '{' ~ token_stream* '}'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "token_stream_delim", _state, tell(), "'{' ~ token_stream* '}'");
         std::optional<std::monostate> _cut_var = std::nullopt;
-        auto _literal = lexer.expect().punct(lex::Punct::LBRACE);
+        auto _literal = lexer.expect().accept(lex::Punct::LBRACE);
         if (_literal) {
         _cut_var = std::optional<std::monostate>(std::monostate{});
         auto _user_opt_a = parse__loop0_26_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RBRACE);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RBRACE);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "token_stream_delim", _state, tell(), "'{' ~ token_stream* '}'");
             _res = ast::TokenStream ( /* ? ? ? */ );
@@ -3580,6 +3689,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_token_stream_no_parens_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(token_stream_no_parens);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // ((!any_paren any_token))+
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "token_stream_no_parens", _state, tell(), "((!any_paren any_token))+");
@@ -3607,10 +3717,11 @@ std::optional<std::monostate> Parser::parse_any_paren_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(any_paren);
     std::optional<std::monostate> _res = std::nullopt;
     { // '('
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_paren", _state, tell(), "'('");
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "any_paren", _state, tell(), "'('");
             _res = std::monostate{};
@@ -3623,7 +3734,7 @@ std::optional<std::monostate> Parser::parse_any_paren_rule()
     }
     { // ')'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_paren", _state, tell(), "')'");
-        auto _literal = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "any_paren", _state, tell(), "')'");
             _res = std::monostate{};
@@ -3636,7 +3747,7 @@ std::optional<std::monostate> Parser::parse_any_paren_rule()
     }
     { // '['
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_paren", _state, tell(), "'['");
-        auto _literal = lexer.expect().punct(lex::Punct::LSQB);
+        auto _literal = lexer.expect().accept(lex::Punct::LSQB);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "any_paren", _state, tell(), "'['");
             _res = std::monostate{};
@@ -3649,7 +3760,7 @@ std::optional<std::monostate> Parser::parse_any_paren_rule()
     }
     { // ']'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_paren", _state, tell(), "']'");
-        auto _literal = lexer.expect().punct(lex::Punct::RSQB);
+        auto _literal = lexer.expect().accept(lex::Punct::RSQB);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "any_paren", _state, tell(), "']'");
             _res = std::monostate{};
@@ -3662,7 +3773,7 @@ std::optional<std::monostate> Parser::parse_any_paren_rule()
     }
     { // '{'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_paren", _state, tell(), "'{'");
-        auto _literal = lexer.expect().punct(lex::Punct::LBRACE);
+        auto _literal = lexer.expect().accept(lex::Punct::LBRACE);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "any_paren", _state, tell(), "'{'");
             _res = std::monostate{};
@@ -3675,7 +3786,7 @@ std::optional<std::monostate> Parser::parse_any_paren_rule()
     }
     { // '}'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_paren", _state, tell(), "'}'");
-        auto _literal = lexer.expect().punct(lex::Punct::RBRACE);
+        auto _literal = lexer.expect().accept(lex::Punct::RBRACE);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "any_paren", _state, tell(), "'}'");
             _res = std::monostate{};
@@ -3699,6 +3810,7 @@ std::optional<lex::Token> Parser::parse_any_token_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(any_token);
     std::optional<lex::Token> _res = std::nullopt;
     { // NAME
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "any_token", _state, tell(), "NAME");
@@ -3778,6 +3890,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_expr_6_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(expr_6);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // primary_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "expr_6", _state, tell(), "primary_expr");
@@ -3814,6 +3927,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_primary_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(primary_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // NUMBER
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "primary_expr", _state, tell(), "NUMBER");
@@ -3846,7 +3960,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_primary_expr_rule()
     }
     { // '...'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "primary_expr", _state, tell(), "'...'");
-        auto _literal = lexer.expect().punct(lex::Punct::ELLIPSIS);
+        auto _literal = lexer.expect().accept(lex::Punct::ELLIPSIS);
         if (_literal) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "primary_expr", _state, tell(), "'...'");
             _res = ast::Constant ( /* Ellipsis , somehow ... */ );
@@ -3948,6 +4062,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_var_ref_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(var_ref_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // name
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "var_ref_expr", _state, tell(), "name");
@@ -3975,6 +4090,7 @@ std::optional<std::string> Parser::parse_strings_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(strings);
     if (auto _cached = get_cached<RuleType::strings>(_state)) {
         --_level;
         return *_cached;
@@ -4008,14 +4124,15 @@ std::optional<ast::field<ast::expr>> Parser::parse_group_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(group_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '(' weak_expr ')'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "group_expr", _state, tell(), "'(' weak_expr ')'");
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
         auto _single_result = parse_weak_expr_rule();
         if (_single_result) {
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "group_expr", _state, tell(), "'(' weak_expr ')'");
             _res = std::move(_single_result);
@@ -4041,12 +4158,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_tuple_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(tuple_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '(' ')'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "tuple_expr", _state, tell(), "'(' ')'");
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "tuple_expr", _state, tell(), "'(' ')'");
             _res = ast::Tuple ( ast::make_sequence < ast::expr > ( ) );
@@ -4060,13 +4178,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_tuple_expr_rule()
     }
     { // '(' ','.expr+ ','? ')'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "tuple_expr", _state, tell(), "'(' ','.expr+ ','? ')'");
-        auto _literal = lexer.expect().punct(lex::Punct::LPAR);
+        auto _literal = lexer.expect().accept(lex::Punct::LPAR);
         if (_literal) {
         auto _user_opt_a = parse__gather_29_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _opt_var = lexer.expect().punct(lex::Punct::COMMA);
+        auto _opt_var = lexer.expect().accept(lex::Punct::COMMA);
         if (true) { (void)_opt_var;
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RPAR);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RPAR);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "tuple_expr", _state, tell(), "'(' ','.expr+ ','? ')'");
             _res = ast::Tuple ( std::move ( a ) );
@@ -4093,12 +4211,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_array_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(array_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '[' ']'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "array_expr", _state, tell(), "'[' ']'");
-        auto _literal = lexer.expect().punct(lex::Punct::LSQB);
+        auto _literal = lexer.expect().accept(lex::Punct::LSQB);
         if (_literal) {
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RSQB);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RSQB);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "array_expr", _state, tell(), "'[' ']'");
             _res = ast::Array ( ast::make_sequence < ast::expr > ( ) );
@@ -4112,13 +4231,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_array_expr_rule()
     }
     { // '[' ','.expr+ ','? ']'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "array_expr", _state, tell(), "'[' ','.expr+ ','? ']'");
-        auto _literal = lexer.expect().punct(lex::Punct::LSQB);
+        auto _literal = lexer.expect().accept(lex::Punct::LSQB);
         if (_literal) {
         auto _user_opt_a = parse__gather_31_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
-        auto _opt_var = lexer.expect().punct(lex::Punct::COMMA);
+        auto _opt_var = lexer.expect().accept(lex::Punct::COMMA);
         if (true) { (void)_opt_var;
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RSQB);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RSQB);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "array_expr", _state, tell(), "'[' ','.expr+ ','? ']'");
             _res = ast::Array ( std::move ( a ) );
@@ -4145,10 +4264,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_ctime_block_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(ctime_block_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'ctime' block_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "ctime_block_expr", _state, tell(), "'ctime' block_expr");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::CTIME);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::CTIME);
         if (_keyword) {
         auto _user_opt_b = parse_block_expr_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
@@ -4175,6 +4295,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_block_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(block_expr);
     if (auto _cached = get_cached<RuleType::block_expr>(_state)) {
         --_level;
         return *_cached;
@@ -4182,13 +4303,13 @@ std::optional<ast::field<ast::expr>> Parser::parse_block_expr_rule()
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '{' stmt* expr_or_unit '}'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "block_expr", _state, tell(), "'{' stmt* expr_or_unit '}'");
-        auto _literal = lexer.expect().punct(lex::Punct::LBRACE);
+        auto _literal = lexer.expect().accept(lex::Punct::LBRACE);
         if (_literal) {
         auto _user_opt_b = parse__loop0_33_rule();
         if (_user_opt_b) { auto b = std::move(*_user_opt_b);
         auto _user_opt_v = parse_expr_or_unit_rule();
         if (_user_opt_v) { auto v = std::move(*_user_opt_v);
-        auto _literal_1 = lexer.expect().punct(lex::Punct::RBRACE);
+        auto _literal_1 = lexer.expect().accept(lex::Punct::RBRACE);
         if (_literal_1) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "block_expr", _state, tell(), "'{' stmt* expr_or_unit '}'");
             _res = ast::Block ( std::move ( b ) , std::move ( v ) );
@@ -4217,13 +4338,14 @@ std::optional<ast::field<ast::expr>> Parser::parse_attr_name_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(attr_name);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // name
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "attr_name", _state, tell(), "name");
         auto _user_opt_n = parse_name_rule();
         if (_user_opt_n) { auto n = std::move(*_user_opt_n);
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "attr_name", _state, tell(), "name");
-            _res = ast::Constant ( std::move ( n ) );
+            _res = ast::Constant ( std::string {n . str ( )} );
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "name");
             --_level;
             return _res;
@@ -4257,6 +4379,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_weak_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(weak_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // infix_call_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "weak_expr", _state, tell(), "infix_call_expr");
@@ -4297,6 +4420,7 @@ std::optional<ast::field<ast::expr>> Parser::parse_infix_call_expr_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(infix_call_expr);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // expr_4 name expr_4
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "infix_call_expr", _state, tell(), "expr_4 name expr_4");
@@ -4323,14 +4447,15 @@ std::optional<ast::field<ast::expr>> Parser::parse_infix_call_expr_rule()
 }
 
 // name: NAME
-std::optional<std::string> Parser::parse_name_rule()
+std::optional<ast::identifier> Parser::parse_name_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<std::string> _res = std::nullopt;
+    PARSER_PROFILE_(name);
+    std::optional<ast::identifier> _res = std::nullopt;
     { // NAME
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "name", _state, tell(), "NAME");
         auto _user_opt_a = lexer.expect().token(lex::TokenType::name);
@@ -4350,20 +4475,21 @@ std::optional<std::string> Parser::parse_name_rule()
 }
 
 // xtime_flag: 'ctime' | 'rtime' | 
-std::optional<ast::field<ast::xtime_flag>> Parser::parse_xtime_flag_rule()
+std::optional<ast::xtime_flag> Parser::parse_xtime_flag_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<ast::field<ast::xtime_flag>> _res = std::nullopt;
+    PARSER_PROFILE_(xtime_flag);
+    std::optional<ast::xtime_flag> _res = std::nullopt;
     { // 'ctime'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "xtime_flag", _state, tell(), "'ctime'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::CTIME);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::CTIME);
         if (_keyword) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "xtime_flag", _state, tell(), "'ctime'");
-            _res = ast::CTime ( );
+            _res = ast::xtime_flag::CTime;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'ctime'");
             --_level;
             return _res;
@@ -4373,10 +4499,10 @@ std::optional<ast::field<ast::xtime_flag>> Parser::parse_xtime_flag_rule()
     }
     { // 'rtime'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "xtime_flag", _state, tell(), "'rtime'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::RTIME);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::RTIME);
         if (_keyword) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "xtime_flag", _state, tell(), "'rtime'");
-            _res = ast::RTime ( );
+            _res = ast::xtime_flag::RTime;
             PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "'rtime'");
             --_level;
             return _res;
@@ -4387,7 +4513,7 @@ std::optional<ast::field<ast::xtime_flag>> Parser::parse_xtime_flag_rule()
     { // 
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "xtime_flag", _state, tell(), "");
         PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "xtime_flag", _state, tell(), "");
-        _res = ast::DefaultTime ( );
+        _res = ast::xtime_flag::DefaultTime;
         PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "");
         --_level;
         return _res;
@@ -4406,10 +4532,11 @@ std::optional<ast::field<ast::expr>> Parser::parse_type_annotation_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(type_annotation);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // ':' expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "type_annotation", _state, tell(), "':' expr");
-        auto _literal = lexer.expect().punct(lex::Punct::COLON);
+        auto _literal = lexer.expect().accept(lex::Punct::COLON);
         if (_literal) {
         auto _user_opt_a = parse_expr_rule();
         if (_user_opt_a) { auto a = std::move(*_user_opt_a);
@@ -4428,22 +4555,23 @@ std::optional<ast::field<ast::expr>> Parser::parse_type_annotation_rule()
     return std::nullopt;
 }
 
-// _loop0_1: stmt
+// _loop0_1: top_level_stmt
 std::optional<ast::sequence<ast::stmt>> Parser::parse__loop0_1_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_1);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     std::vector<ast::field<ast::stmt>> _children{};
-    { // stmt
-        PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop0_1", _state, tell(), "stmt");
+    { // top_level_stmt
+        PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop0_1", _state, tell(), "top_level_stmt");
         while (true) {
-            auto _single_result = parse_stmt_rule();
+            auto _single_result = parse_top_level_stmt_rule();
             if (_single_result) {
                 _res = std::move(_single_result);
-                PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "stmt");
+                PARSER_DBG_("Hit with action [%zu-%zu]: %s\n", _state, tell(), "top_level_stmt");
                 _children.push_back(std::move(*_res));
                 _state = tell();
                 continue;
@@ -4451,7 +4579,7 @@ std::optional<ast::sequence<ast::stmt>> Parser::parse__loop0_1_rule()
             break;
         }
         seek(_state);
-        PARSER_DBG_("%*c- %s[%zu-%zu]: %s failed!\n", _level, ' ', "_loop0_1", _state, tell(), "stmt");
+        PARSER_DBG_("%*c- %s[%zu-%zu]: %s failed!\n", _level, ' ', "_loop0_1", _state, tell(), "top_level_stmt");
     }
     auto _seq = ast::make_sequence<ast::stmt>();
     for (auto &_child : _children) {
@@ -4469,10 +4597,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_2_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_2);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '=' expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_2", _state, tell(), "'=' expr");
-        auto _literal = lexer.expect().punct(lex::Punct::EQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::EQUAL);
         if (_literal) {
         auto _single_result = parse_expr_rule();
         if (_single_result) {
@@ -4498,6 +4627,7 @@ std::optional<ast::sequence<ast::stmt>> Parser::parse__loop0_3_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_3);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     std::vector<ast::field<ast::stmt>> _children{};
     { // stmt
@@ -4532,10 +4662,11 @@ std::optional<std::monostate> Parser::parse__tmp_4_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_4);
     std::optional<std::monostate> _res = std::nullopt;
     { // 'class'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_4", _state, tell(), "'class'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::CLASS);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::CLASS);
         if (_keyword) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "_tmp_4", _state, tell(), "'class'");
             _res = std::monostate{};
@@ -4548,7 +4679,7 @@ std::optional<std::monostate> Parser::parse__tmp_4_rule()
     }
     { // 'struct'
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_4", _state, tell(), "'struct'");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::STRUCT);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::STRUCT);
         if (_keyword) {
             PARSER_DBG_("%*c+ %s[%zu-%zu]: %s succeeded!\n", _level, ' ', "_tmp_4", _state, tell(), "'struct'");
             _res = std::monostate{};
@@ -4565,18 +4696,19 @@ std::optional<std::monostate> Parser::parse__tmp_4_rule()
 }
 
 // _loop0_6: '::' name
-std::optional<std::vector<std::string>> Parser::parse__loop0_6_rule()
+std::optional<std::vector<ast::identifier>> Parser::parse__loop0_6_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
-    std::optional<std::string> _res = std::nullopt;
-    std::vector<std::string> _children{};
+    PARSER_PROFILE_(_loop0_6);
+    std::optional<ast::identifier> _res = std::nullopt;
+    std::vector<ast::identifier> _children{};
     { // '::' name
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop0_6", _state, tell(), "'::' name");
         while (true) {
-            auto _literal = lexer.expect().punct(lex::Punct::DOUBLECOLON);
+            auto _literal = lexer.expect().accept(lex::Punct::DOUBLECOLON);
             if (_literal) {
             auto _user_opt_elem = parse_name_rule();
             if (_user_opt_elem) { auto elem = std::move(*_user_opt_elem);
@@ -4597,14 +4729,15 @@ std::optional<std::vector<std::string>> Parser::parse__loop0_6_rule()
 }
 
 // _gather_5: name _loop0_6
-std::optional<std::vector<std::string>> Parser::parse__gather_5_rule()
+std::optional<std::vector<ast::identifier>> Parser::parse__gather_5_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     const auto _state = tell();
     (void)_state;
-    std::optional<std::vector<std::string>> _res = std::nullopt;
+    PARSER_PROFILE_(_gather_5);
+    std::optional<std::vector<ast::identifier>> _res = std::nullopt;
     { // name _loop0_6
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_gather_5", _state, tell(), "name _loop0_6");
         auto _user_opt_name_var = parse_name_rule();
@@ -4633,6 +4766,7 @@ std::optional<ast::sequence<ast::arg_spec>> Parser::parse__loop0_7_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_7);
     std::optional<ast::field<ast::arg_spec>> _res = std::nullopt;
     std::vector<ast::field<ast::arg_spec>> _children{};
     { // (',' arg_spec)
@@ -4666,12 +4800,13 @@ std::optional<ast::sequence<ast::arg_spec>> Parser::parse__loop0_9_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_9);
     std::optional<ast::field<ast::arg_spec>> _res = std::nullopt;
     std::vector<ast::field<ast::arg_spec>> _children{};
     { // ',' arg_spec
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop0_9", _state, tell(), "',' arg_spec");
         while (true) {
-            auto _literal = lexer.expect().punct(lex::Punct::COMMA);
+            auto _literal = lexer.expect().accept(lex::Punct::COMMA);
             if (_literal) {
             auto _user_opt_elem = parse_arg_spec_rule();
             if (_user_opt_elem) { auto elem = std::move(*_user_opt_elem);
@@ -4703,6 +4838,7 @@ std::optional<ast::sequence<ast::arg_spec>> Parser::parse__gather_8_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_gather_8);
     std::optional<ast::sequence<ast::arg_spec>> _res = std::nullopt;
     { // arg_spec _loop0_9
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_gather_8", _state, tell(), "arg_spec _loop0_9");
@@ -4733,10 +4869,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_10_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_10);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // '=' expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_10", _state, tell(), "'=' expr");
-        auto _literal = lexer.expect().punct(lex::Punct::EQUAL);
+        auto _literal = lexer.expect().accept(lex::Punct::EQUAL);
         if (_literal) {
         auto _single_result = parse_expr_rule();
         if (_single_result) {
@@ -4763,10 +4900,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_11_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_11);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'else' flow_block
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_11", _state, tell(), "'else' flow_block");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::ELSE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::ELSE);
         if (_keyword) {
         auto _single_result = parse_flow_block_rule();
         if (_single_result) {
@@ -4793,10 +4931,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_12_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_12);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'else' flow_block
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_12", _state, tell(), "'else' flow_block");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::ELSE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::ELSE);
         if (_keyword) {
         auto _single_result = parse_flow_block_rule();
         if (_single_result) {
@@ -4823,10 +4962,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_13_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_13);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'else' flow_block
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_13", _state, tell(), "'else' flow_block");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::ELSE);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::ELSE);
         if (_keyword) {
         auto _single_result = parse_flow_block_rule();
         if (_single_result) {
@@ -4852,6 +4992,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop1_14_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop1_14);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // ('and' expr_1)
@@ -4889,6 +5030,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop1_15_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop1_15);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // ('or' expr_1)
@@ -4920,14 +5062,15 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop1_15_rule()
 }
 
 // _loop1_16: comparison_followup_pair
-std::optional<std::vector<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>>> Parser::parse__loop1_16_rule()
+std::optional<std::vector<std::pair < ast::cmp_op , ast::field < ast::expr >>>> Parser::parse__loop1_16_rule()
 {
     if (++_level > MAX_RECURSION_LEVEL) {
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
-    std::optional<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>> _res = std::nullopt;
-    std::vector<std::pair < ast::field < ast::cmp_op > , ast::field < ast::expr >>> _children{};
+    PARSER_PROFILE_(_loop1_16);
+    std::optional<std::pair < ast::cmp_op , ast::field < ast::expr >>> _res = std::nullopt;
+    std::vector<std::pair < ast::cmp_op , ast::field < ast::expr >>> _children{};
     { // comparison_followup_pair
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop1_16", _state, tell(), "comparison_followup_pair");
         while (true) {
@@ -4960,6 +5103,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_17_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_17);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // sum_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_17", _state, tell(), "sum_expr");
@@ -5000,6 +5144,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_18_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_18);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // product_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_18", _state, tell(), "product_expr");
@@ -5040,6 +5185,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_19_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_19);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // bitor_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_19", _state, tell(), "bitor_expr");
@@ -5080,6 +5226,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_20_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_20);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // bitand_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_20", _state, tell(), "bitand_expr");
@@ -5120,6 +5267,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_21_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_21);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // bitxor_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_21", _state, tell(), "bitxor_expr");
@@ -5160,6 +5308,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_22_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_22);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // shift_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_22", _state, tell(), "shift_expr");
@@ -5200,6 +5349,7 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_23_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_23);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // unary_expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_23", _state, tell(), "unary_expr");
@@ -5239,6 +5389,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop0_24_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_24);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // token_stream
@@ -5272,6 +5423,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop0_25_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_25);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // token_stream
@@ -5305,6 +5457,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop0_26_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_26);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // token_stream
@@ -5338,6 +5491,7 @@ std::optional<std::vector<lex::Token>> Parser::parse__loop1_27_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop1_27);
     std::optional<lex::Token> _res = std::nullopt;
     std::vector<lex::Token> _children{};
     { // (!any_paren any_token)
@@ -5371,6 +5525,7 @@ std::optional<std::vector<lex::Token>> Parser::parse__loop1_28_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop1_28);
     std::optional<lex::Token> _res = std::nullopt;
     std::vector<lex::Token> _children{};
     { // STRING
@@ -5404,12 +5559,13 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop0_30_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_30);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // ',' expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop0_30", _state, tell(), "',' expr");
         while (true) {
-            auto _literal = lexer.expect().punct(lex::Punct::COMMA);
+            auto _literal = lexer.expect().accept(lex::Punct::COMMA);
             if (_literal) {
             auto _user_opt_elem = parse_expr_rule();
             if (_user_opt_elem) { auto elem = std::move(*_user_opt_elem);
@@ -5441,6 +5597,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__gather_29_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_gather_29);
     std::optional<ast::sequence<ast::expr>> _res = std::nullopt;
     { // expr _loop0_30
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_gather_29", _state, tell(), "expr _loop0_30");
@@ -5470,12 +5627,13 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__loop0_32_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_32);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     std::vector<ast::field<ast::expr>> _children{};
     { // ',' expr
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_loop0_32", _state, tell(), "',' expr");
         while (true) {
-            auto _literal = lexer.expect().punct(lex::Punct::COMMA);
+            auto _literal = lexer.expect().accept(lex::Punct::COMMA);
             if (_literal) {
             auto _user_opt_elem = parse_expr_rule();
             if (_user_opt_elem) { auto elem = std::move(*_user_opt_elem);
@@ -5507,6 +5665,7 @@ std::optional<ast::sequence<ast::expr>> Parser::parse__gather_31_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_gather_31);
     std::optional<ast::sequence<ast::expr>> _res = std::nullopt;
     { // expr _loop0_32
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_gather_31", _state, tell(), "expr _loop0_32");
@@ -5536,6 +5695,7 @@ std::optional<ast::sequence<ast::stmt>> Parser::parse__loop0_33_rule()
         throw SyntaxError("Recursion limit exceeded");
     }
     auto _state = tell();
+    PARSER_PROFILE_(_loop0_33);
     std::optional<ast::field<ast::stmt>> _res = std::nullopt;
     std::vector<ast::field<ast::stmt>> _children{};
     { // stmt
@@ -5570,10 +5730,11 @@ std::optional<ast::field<ast::arg_spec>> Parser::parse__tmp_34_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_34);
     std::optional<ast::field<ast::arg_spec>> _res = std::nullopt;
     { // ',' arg_spec
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_34", _state, tell(), "',' arg_spec");
-        auto _literal = lexer.expect().punct(lex::Punct::COMMA);
+        auto _literal = lexer.expect().accept(lex::Punct::COMMA);
         if (_literal) {
         auto _single_result = parse_arg_spec_rule();
         if (_single_result) {
@@ -5600,10 +5761,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_35_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_35);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'and' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_35", _state, tell(), "'and' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::AND);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::AND);
         if (_keyword) {
         auto _single_result = parse_expr_1_rule();
         if (_single_result) {
@@ -5630,10 +5792,11 @@ std::optional<ast::field<ast::expr>> Parser::parse__tmp_36_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_36);
     std::optional<ast::field<ast::expr>> _res = std::nullopt;
     { // 'or' expr_1
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_36", _state, tell(), "'or' expr_1");
-        auto _keyword = lexer.expect().keyword(lex::HardKeyword::OR);
+        auto _keyword = lexer.expect().accept(lex::HardKeyword::OR);
         if (_keyword) {
         auto _single_result = parse_expr_1_rule();
         if (_single_result) {
@@ -5660,6 +5823,7 @@ std::optional<lex::Token> Parser::parse__tmp_37_rule()
     }
     const auto _state = tell();
     (void)_state;
+    PARSER_PROFILE_(_tmp_37);
     std::optional<lex::Token> _res = std::nullopt;
     { // !any_paren any_token
         PARSER_DBG_("%*c> %s[%zu-%zu]: %s\n", _level, ' ', "_tmp_37", _state, tell(), "!any_paren any_token");
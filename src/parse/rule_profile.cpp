@@ -0,0 +1,46 @@
+#include <bondrewd/parse/rule_profile.hpp>
+
+
+namespace bondrewd::parse {
+
+
+void RuleProfile::leave(unsigned rule, state_t state, uint64_t mark) {
+    assert(rule < stats.size());
+    assert(mark < invocations);
+
+    RuleStats &rule_stats = stats[rule];
+    uint64_t work = invocations - mark;
+
+    ++rule_stats.calls;
+    rule_stats.work += work;
+
+    auto [it, inserted] = first_work[rule].try_emplace(state, work);
+
+    if (inserted) {
+        ++rule_stats.positions;
+    } else {
+        ++rule_stats.repeats;
+        rule_stats.repeated_work += it->second;
+    }
+}
+
+
+std::ostream &RuleProfile::dump(std::ostream &stream) const {
+    stream << "# rule calls positions repeats work repeated_work\n";
+
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const RuleStats &rule_stats = stats[i];
+
+        if (rule_stats.calls == 0) {
+            continue;
+        }
+
+        stream << rule_names[i] << " " << rule_stats.calls << " " << rule_stats.positions << " "
+               << rule_stats.repeats << " " << rule_stats.work << " " << rule_stats.repeated_work << "\n";
+    }
+
+    return stream;
+}
+
+
+}  // namespace bondrewd::parse
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <iostream>
+#include <cstdlib>
+
+
+/**
+ * The tests are plain executables, registered with ctest one per file.
+ * A failed CHECK reports itself and fails the test, but doesn't stop it.
+ */
+namespace bondrewd::test {
+
+inline int failures = 0;
+
+inline int report() {
+    if (failures) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+}  // namespace bondrewd::test
+
+
+#define CHECK(cond)                                                                  \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #cond ") failed\n"; \
+            ++bondrewd::test::failures;                                              \
+        }                                                                            \
+    } while (false)
@@ -0,0 +1,111 @@
+#include <bondrewd/internal/mapped_file.hpp>
+
+#include "check.hpp"
+
+#include <string>
+#include <thread>
+#include <random>
+#include <fstream>
+#include <filesystem>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+using namespace bondrewd;
+namespace fs = std::filesystem;
+
+
+/// Larger than the initial read buffer, so that reading has to grow it
+static std::string make_contents() {
+    std::string result{};
+
+    for (int i = 0; result.size() < 200 * 1024; ++i) {
+        result += "x" + std::to_string(i) + " = " + std::to_string(i * 7) + ";\n";
+    }
+
+    return result;
+}
+
+
+static void test_regular(const fs::path &dir, const std::string &contents) {
+    fs::path path = dir / "regular.bdw";
+    std::ofstream{path, std::ios::binary} << contents;
+
+    util::MappedFile file = util::MappedFile::open(path);
+    CHECK(file.view() == contents);
+
+    fs::path empty = dir / "empty.bdw";
+    std::ofstream{empty, std::ios::binary};
+
+    util::MappedFile empty_file = util::MappedFile::open(empty);
+    CHECK(empty_file.size() == 0);
+    CHECK(!empty_file.is_mapped());
+}
+
+
+#if !defined(_WIN32)
+static void test_fifo(const fs::path &dir, const std::string &contents) {
+    fs::path path = dir / "fifo.bdw";
+    CHECK(::mkfifo(path.c_str(), 0600) == 0);
+
+    // Opening the writing end blocks until the file is opened for reading
+    std::thread writer{[&] {
+        std::ofstream{path, std::ios::binary} << contents;
+    }};
+
+    util::MappedFile file = util::MappedFile::open(path);
+    writer.join();
+
+    CHECK(!file.is_mapped());
+    CHECK(file.view() == contents);
+}
+
+
+static void test_pipe(const std::string &contents) {
+    int fds[2]{};
+    CHECK(::pipe(fds) == 0);
+
+    // What `bondrewd <(...)` is given
+    fs::path path = "/dev/fd/" + std::to_string(fds[0]);
+
+    std::thread writer{[&] {
+        for (size_t done = 0; done < contents.size(); ) {
+            ssize_t count = ::write(fds[1], contents.data() + done, contents.size() - done);
+            if (count <= 0) break;
+            done += (size_t)count;
+        }
+
+        ::close(fds[1]);
+    }};
+
+    util::MappedFile file = util::MappedFile::open(path);
+    writer.join();
+    ::close(fds[0]);
+
+    CHECK(!file.is_mapped());
+    CHECK(file.view() == contents);
+}
+#endif
+
+
+int main() {
+    fs::path dir = fs::temp_directory_path() / ("bondrewd-test-mapped-file-" + std::to_string(std::random_device{}()));
+    fs::create_directories(dir);
+
+    std::string contents = make_contents();
+
+    test_regular(dir, contents);
+
+#if !defined(_WIN32)
+    test_fifo(dir, contents);
+    test_pipe(contents);
+#endif
+
+    fs::remove_all(dir);
+
+    return test::report();
+}
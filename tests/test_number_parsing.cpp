@@ -0,0 +1,150 @@
+#include <bondrewd/lex/number_parsing.hpp>
+
+#include "check.hpp"
+
+#include <string>
+#include <cmath>
+#include <limits>
+
+
+using namespace bondrewd;
+using lex::numbers::parse_integer;
+using lex::numbers::parse_decimal_float;
+using lex::numbers::parse_binary_float;
+
+
+static constexpr uint64_t max_u64 = std::numeric_limits<uint64_t>::max();
+
+
+/// Exactly equal, including the sign of zeros
+static bool same(double value, double expected) {
+    return value == expected && std::signbit(value) == std::signbit(expected);
+}
+
+
+static void test_integer_chunks() {
+    // Long enough to go through the 8-digit path at least once, with a tail
+    CHECK(parse_integer("11010110" "10011110" "101", 2) == 0b11010110'10011110'101ull);
+    CHECK(parse_integer("12345670" "76543210" "7", 8) == 012345670'76543210'7ull);
+    CHECK(parse_integer("98765432" "10123456" "78", 10) == 98765432'10123456'78ull);
+    CHECK(parse_integer("0123abcd" "EF45AbCd", 16) == 0x0123abcd'ef45abcdull);
+    CHECK(parse_integer("fFfFfFfF", 16) == 0xffffffffull);
+    CHECK(parse_integer("a0B1c2D3" "e4F5", 16) == 0xa0b1c2d3'e4f5ull);
+
+    // Every digit in every lane
+    for (char digit = '0'; digit <= '9'; ++digit) {
+        CHECK(parse_integer(std::string(8, digit), 10) == (uint64_t)(digit - '0') * 11111111ull);
+    }
+
+    CHECK(parse_integer("", 10) == 0u);
+    CHECK(parse_integer("0000000000000000000000000000", 10) == 0u);
+}
+
+
+static void test_integer_limits() {
+    CHECK(parse_integer(std::string(64, '1'), 2) == max_u64);
+    CHECK(parse_integer("1" + std::string(64, '0'), 2) == std::nullopt);
+
+    CHECK(parse_integer("1777777777777777777777", 8) == max_u64);
+    CHECK(parse_integer("2000000000000000000000", 8) == std::nullopt);
+    CHECK(parse_integer("7777777777777777777777", 8) == std::nullopt);
+
+    CHECK(parse_integer("18446744073709551615", 10) == max_u64);
+    CHECK(parse_integer("18446744073709551616", 10) == std::nullopt);
+    CHECK(parse_integer("99999999999999999999", 10) == std::nullopt);
+    CHECK(parse_integer("100000000000000000000", 10) == std::nullopt);
+
+    CHECK(parse_integer("FFFFFFFFffffffff", 16) == max_u64);
+    CHECK(parse_integer("10000000000000000", 16) == std::nullopt);
+
+    // Leading zeros don't count towards the limit
+    CHECK(parse_integer("000000000018446744073709551615", 10) == max_u64);
+    CHECK(parse_integer("0000" + std::string(64, '1'), 2) == max_u64);
+}
+
+
+static void test_binary_float_rounding() {
+    CHECK(same(parse_binary_float("1", "8", 0, 16), 1.5));
+    CHECK(same(parse_binary_float("A", "bC", 0, 16), 10.0 + 0xbc / 256.0));
+    CHECK(same(parse_binary_float("7", "4", 1, 8), 60.0));
+    CHECK(same(parse_binary_float("0", "000", 5, 16), 0.0));
+
+    // 2**53 + 1 is halfway between two doubles, and the even one is below
+    CHECK(same(parse_binary_float("1" + std::string(52, '0') + "1", "", 0, 2), std::ldexp(1.0, 53)));
+    // 2**53 + 3 is halfway as well, but the even one is above
+    CHECK(same(parse_binary_float("1" + std::string(51, '0') + "11", "", 0, 2), std::ldexp(1.0, 53) + 4));
+
+    // Past 64 bits, the digits only survive as the sticky bit, which breaks the tie upwards
+    std::string tie = "1" + std::string(52, '0') + "1" + std::string(21, '0');
+    CHECK(same(parse_binary_float(tie, "", 0, 2), std::ldexp(1.0, 74)));
+    CHECK(same(parse_binary_float(tie.substr(0, tie.size() - 1) + "1", "", 0, 2), std::ldexp(1.0, 74) + std::ldexp(1.0, 22)));
+    CHECK(same(parse_binary_float(tie, std::string(40, '0') + "1", 0, 2), std::ldexp(1.0, 74) + std::ldexp(1.0, 22)));
+
+    // The same in hex, where the digits past 64 bits are whole hex digits
+    CHECK(same(parse_binary_float("20000000000001" "000", "", 0, 16), std::ldexp(1.0, 65)));
+    CHECK(same(parse_binary_float("20000000000001" "001", "", 0, 16), std::ldexp(1.0, 65) + std::ldexp(1.0, 13)));
+}
+
+
+static void test_binary_float_edges() {
+    const double min_subnormal = std::numeric_limits<double>::denorm_min();
+    const double max_double = std::numeric_limits<double>::max();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    CHECK(same(parse_binary_float("1", "", -1074, 2), min_subnormal));
+    CHECK(same(parse_binary_float("1", "", -1022, 2), std::numeric_limits<double>::min()));
+    CHECK(same(parse_binary_float("11", "", -1074, 2), 3 * min_subnormal));
+
+    // Halfway to the smallest subnormal ties to zero, anything above rounds up to it
+    CHECK(same(parse_binary_float("1", "", -1075, 2), 0.0));
+    CHECK(same(parse_binary_float("11", "", -1076, 2), min_subnormal));
+    CHECK(same(parse_binary_float("1", "0000000001", -1075, 2), min_subnormal));
+    CHECK(same(parse_binary_float("1", std::string(70, '0') + "1", -1075, 2), min_subnormal));
+    // 1.5 and 2.5 times the smallest subnormal tie to the even neighbour
+    CHECK(same(parse_binary_float("11", "", -1075, 2), 2 * min_subnormal));
+    CHECK(same(parse_binary_float("101", "", -1075, 2), 2 * min_subnormal));
+
+    // Just below the smallest normal, past the subnormals' precision, rounds up to it
+    CHECK(same(parse_binary_float("1", std::string(53, '1'), -1023, 2), std::numeric_limits<double>::min()));
+
+    CHECK(same(parse_binary_float("1", "", -2000, 2), 0.0));
+    CHECK(same(parse_binary_float("F", "", -1000, 16), 0.0));
+    CHECK(same(parse_binary_float("1", "", std::numeric_limits<int64_t>::min(), 16), 0.0));
+
+    CHECK(same(parse_binary_float("1", std::string(52, '1'), 1023, 2), max_double));
+    CHECK(same(parse_binary_float("1", std::string(53, '1'), 1023, 2), inf));
+    CHECK(same(parse_binary_float("1", "", 1024, 2), inf));
+    CHECK(same(parse_binary_float("1", "", 256, 16), inf));
+    CHECK(same(parse_binary_float("1", "", std::numeric_limits<int64_t>::max(), 8), inf));
+}
+
+
+static void test_decimal_float() {
+    CHECK(same(parse_decimal_float("2.5"), 2.5));
+    CHECK(same(parse_decimal_float("1e10"), 1e10));
+    CHECK(same(parse_decimal_float("0.1"), 0.1));
+
+    // Correctly rounded, even where a naive conversion isn't
+    CHECK(same(parse_decimal_float("9007199254740993"), 9007199254740992.0));
+    CHECK(same(parse_decimal_float("9007199254740993.000000000000000000001"), 9007199254740994.0));
+
+    CHECK(same(parse_decimal_float("1.7976931348623157e308"), std::numeric_limits<double>::max()));
+    CHECK(same(parse_decimal_float("4.9406564584124654e-324"), std::numeric_limits<double>::denorm_min()));
+
+    // Out of range, which from_chars reports without a value
+    CHECK(same(parse_decimal_float("1e400"), std::numeric_limits<double>::infinity()));
+    CHECK(same(parse_decimal_float("1.8e308"), std::numeric_limits<double>::infinity()));
+    CHECK(same(parse_decimal_float("1e-400"), 0.0));
+    CHECK(same(parse_decimal_float("2e-324"), 0.0));
+}
+
+
+int main() {
+    test_integer_chunks();
+    test_integer_limits();
+    test_binary_float_rounding();
+    test_binary_float_edges();
+    test_decimal_float();
+
+    return test::report();
+}
@@ -0,0 +1,87 @@
+#include <bondrewd/lex/tokenizer.hpp>
+
+#include "check.hpp"
+
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+
+using namespace bondrewd;
+
+
+/// Small, so that every long run spans many windows
+static constexpr size_t chunk_size = 1024;
+
+static constexpr size_t long_size = 256 * 1024;
+
+
+static std::string make_filler(size_t size) {
+    std::string result{};
+
+    while (result.size() < size) {
+        result += "lorem ipsum dolor sit amet ";
+    }
+
+    return result;
+}
+
+
+/**
+ * Streams source, comparing the tokens to the ones lexed from a whole buffer,
+ * and returns the most input the scanner has retained after any token.
+ * Tokens are discarded as soon as they're read, as the retiring Lexer would.
+ */
+static size_t stream_tokens(const std::string &source) {
+    std::istringstream input{source};
+    lex::Tokenizer streamed{lex::Scanner{input, "<stream>", chunk_size}};
+    lex::Tokenizer whole = lex::Tokenizer::from_string(source, "<string>");
+
+    size_t max_retained = 0;
+
+    while (true) {
+        lex::Token token = streamed.get_token();
+        lex::Token expected = whole.get_token();
+
+        CHECK(token.get_type() == expected.get_type());
+        CHECK(token.get_location().file_pos == expected.get_location().file_pos);
+        CHECK(token.get_source() == expected.get_source());
+
+        streamed.discard_before(token.get_location().file_pos);
+        max_retained = std::max(max_retained, streamed.get_scanner().get_retained_size());
+
+        if (token.is_endmarker() || token.get_type() != expected.get_type()) {
+            break;
+        }
+    }
+
+    return max_retained;
+}
+
+
+/// Comments aren't tokens, so they needn't be kept in memory, however long they are
+static void test_comments() {
+    std::string filler = make_filler(long_size);
+
+    CHECK(stream_tokens("a = 1;\n/* " + filler + " */\nb = 2;\n") <= 4 * chunk_size);
+    CHECK(stream_tokens("a = 1;\n/* /* " + filler + " */ */\nb = 2;\n") <= 4 * chunk_size);
+    CHECK(stream_tokens("a = 1; // " + filler + "\nb = 2;\n") <= 4 * chunk_size);
+    CHECK(stream_tokens("a = 1;" + std::string(long_size, ' ') + "b = 2;\n") <= 4 * chunk_size);
+}
+
+
+/// A token must be kept whole, but keeping it mustn't take more than a few times its size
+static void test_long_token() {
+    std::string filler = make_filler(long_size);
+
+    CHECK(stream_tokens("a = " + std::string(long_size, 'x') + ";\nb = 2;\n") <= 4 * long_size);
+    CHECK(stream_tokens("a = \"" + filler + "\";\nb = 2;\n") <= 4 * long_size);
+}
+
+
+int main() {
+    test_comments();
+    test_long_token();
+
+    return test::report();
+}
@@ -0,0 +1,196 @@
+#include <bondrewd/lex/lexer.hpp>
+#include <bondrewd/lex/token_buffer.hpp>
+#include <bondrewd/lex/source_manager.hpp>
+
+#include "check.hpp"
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+
+using namespace bondrewd;
+
+
+/// Exposes the chunking heuristic, so that its boundaries can be checked directly
+struct ChunkingLexer : lex::Lexer {
+    using lex::Lexer::find_chunk_boundaries;
+};
+
+
+/// Everything about a token that the buffer has to reproduce
+static std::string describe(const lex::Token &token) {
+    std::ostringstream result{};
+
+    token.dump(result);
+    result << " @" << token.get_location().file_pos << " `" << token.get_source() << "`";
+
+    return result.str();
+}
+
+
+/// Code with every kind of token payload, some of which need decoding
+static std::string make_code(int idx) {
+    std::string n = std::to_string(idx);
+
+    return "name_" + n + " = " + n + " + 0x" + n + "F * " + n + ".25e-3;\n"
+           "if (name_" + n + " <= 1) { call(\"str\\t" + n + "\", 'single', \"\"\"tri" + n + "\"\"\"); }\n"
+           "# a line comment with a \" quote\n"
+           "// and one with /* an opening delimiter\n";
+}
+
+
+/// Multiline comments and strings, containing what looks like the other one
+static std::string make_block(int idx, size_t lines) {
+    std::string result = idx % 2 ? "/* outer\n" : "x = \"\"\"\n";
+
+    for (size_t i = 0; i < lines; ++i) {
+        if (idx % 2) {
+            const bool nested = i % 8 >= 3 && i % 8 <= 6 && i / 8 < lines / 8;
+
+            result += !nested ? "  'not' a string either\n" : i % 8 == 3 ? "/* nested \"not a string\n" : i % 8 == 6 ? "still nested */\n" : "  /* nested deeper */ 'still not a string\n";
+        } else {
+            result += i % 4 == 1 ? "  /* not a comment\n" : i % 4 == 2 ? "  \\\"\"\" // escaped quote\n" : "  text # text\n";
+        }
+    }
+
+    return result + (idx % 2 ? "*/\n" : "\"\"\";\n");
+}
+
+
+/// Large enough to be split, with most of it inside multiline comments and strings
+static std::string make_source(size_t size) {
+    std::string result{};
+
+    for (int i = 0; result.size() < size; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            result += make_code(i * 20 + j);
+        }
+
+        result += make_block(i, 1000 + 37 * (i % 5));
+    }
+
+    return result;
+}
+
+
+static std::vector<lex::Token> lex_sequentially(const lex::SourceBuffer::ptr_t &source) {
+    lex::Tokenizer tokenizer = lex::Tokenizer::from_buffer(source);
+    std::vector<lex::Token> result{};
+
+    do {
+        result.push_back(tokenizer.get_token());
+    } while (!result.back().is_endmarker());
+
+    return result;
+}
+
+
+static void test_round_trip(const lex::SourceBuffer::ptr_t &source, const std::vector<lex::Token> &expected) {
+    lex::Scanner scanner{source};
+    lex::TokenBuffer tokens{};
+
+    for (const auto &token : expected) {
+        tokens.push(token);
+    }
+
+    CHECK(tokens.size() == expected.size());
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        CHECK(describe(tokens.get(i, scanner)) == describe(expected[i]));
+    }
+}
+
+
+static void test_chunk_boundaries(const lex::SourceBuffer::ptr_t &source, const std::vector<lex::Token> &expected) {
+    static constexpr size_t chunk_count = 16;
+
+    std::vector<size_t> boundaries = ChunkingLexer::find_chunk_boundaries(source->view(), chunk_count);
+    CHECK(boundaries.size() == chunk_count - 1);
+
+    size_t next_token = 0;
+
+    for (size_t boundary : boundaries) {
+        CHECK(boundary > 0 && source->view()[boundary - 1] == '\n');
+
+        while (next_token < expected.size() && expected[next_token].get_location().file_pos < boundary) {
+            ++next_token;
+        }
+
+        // Lexing from the boundary has to run into the same tokens as lexing the whole file
+        lex::Scanner scanner{source};
+        scanner.seek(source->location_at(boundary));
+        lex::Tokenizer tokenizer{std::move(scanner)};
+
+        for (size_t i = next_token; i < std::min(next_token + 64, expected.size()); ++i) {
+            CHECK(describe(tokenizer.get_token()) == describe(expected[i]));
+        }
+    }
+}
+
+
+static void test_pretokenize(const lex::SourceBuffer::ptr_t &source, const std::vector<lex::Token> &expected) {
+    for (unsigned jobs : {1u, 3u, 8u}) {
+        lex::Lexer lexer = lex::Lexer::pretokenize(source, jobs);
+
+        for (size_t i = 0; i < expected.size(); ++i) {
+            CHECK(describe(lexer.peek((int)i)) == describe(expected[i]));
+        }
+
+        CHECK(lexer.at_end());
+    }
+}
+
+
+static void test_discard_front(const lex::SourceBuffer::ptr_t &source, const std::vector<lex::Token> &expected) {
+    lex::Scanner scanner{source};
+    lex::TokenBuffer tokens{};
+
+    for (const auto &token : expected) {
+        tokens.push(token);
+    }
+
+    // Uneven steps, so that the cuts land on every kind of token
+    size_t discarded = 0;
+
+    for (size_t step = 1; tokens.size() > 1; step = step * 3 + 1) {
+        size_t count = std::min(step, tokens.size() - 1);
+
+        tokens.discard_front(count);
+        discarded += count;
+
+        CHECK(tokens.size() == expected.size() - discarded);
+
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            CHECK(describe(tokens.get(i, scanner)) == describe(expected[discarded + i]));
+        }
+    }
+
+    // Payloads added after a discard must not collide with the surviving ones
+    lex::TokenBuffer more{};
+    for (size_t i = 0; i < std::min<size_t>(1000, expected.size()); ++i) {
+        more.push(expected[i]);
+    }
+
+    tokens.append(std::move(more));
+
+    for (size_t i = 1; i < tokens.size(); ++i) {
+        CHECK(describe(tokens.get(i, scanner)) == describe(expected[i - 1]));
+    }
+}
+
+
+int main() {
+    lex::SourceBuffer::ptr_t source = lex::SourceManager::instance.add_string(
+        make_source(4 * lex::Lexer::min_parallel_chunk_size + 12345), "<test>"
+    );
+
+    std::vector<lex::Token> expected = lex_sequentially(source);
+
+    test_round_trip(source, expected);
+    test_chunk_boundaries(source, expected);
+    test_pretokenize(source, expected);
+    test_discard_front(source, expected);
+
+    return test::report();
+}
@@ -4,6 +4,7 @@ import typing
 import argparse
 import pathlib
 import dataclasses
+import hashlib
 from contextlib import contextmanager
 
 import sys
@@ -18,6 +19,7 @@ The script responsible for generating several AST-related source files.
 
 More precisely, the script generates the following files:
     - include/bondrewd/ast/ast_nodes.gen.hpp
+    - include/bondrewd/ast/ast_flat.gen.hpp
 """)
 
 parser.add_argument(
@@ -47,7 +49,37 @@ builtin_types: typing.Dict[str, str] = {
 }
 
 
+# Enum-like sums (with no fields, attributes or extras anywhere) are emitted
+# as plain enum classes and stored by value, instead of behind a field<>.
+simple_sums: typing.Set[str] = set()
+
+# The remaining sums. In the flat representation, these are referenced
+# by a node_ref, which packs the alternative's kind alongside the index.
+complex_sums: typing.Set[str] = set()
+
+# Builtin types with a distinct representation in the flat AST
+flat_builtin_types: typing.Dict[str, str] = {
+    "identifier": "ref<identifier>",
+    "string": "slice<char>",
+    "string_view": "slice<char>",
+}
+
+
 class _helpers:
+    @staticmethod
+    def is_simple_sum(type: asdl.Sum | asdl.Product | asdl.Alias) -> bool:
+        if not isinstance(type, asdl.Sum):
+            return False
+        
+        if type.attributes or type.extras:
+            return False
+        
+        return all(not alt.fields and not alt.extras for alt in type.types)
+    
+    @staticmethod
+    def is_by_value(type: str) -> bool:
+        return type in builtin_types or type in simple_sums
+    
     @staticmethod
     def copyable(type: asdl.Sum | asdl.Product) -> bool:
         if isinstance(type, asdl.Sum):
@@ -61,6 +93,10 @@ class _helpers:
     def names_of_alts(sum_type: asdl.Sum) -> typing.List[str]:
         return [alt.name for alt in sum_type.types]
 
+    @staticmethod
+    def names_of_dfns(module: asdl.Module) -> typing.List[str]:
+        return [type.name for type in module.dfns]
+
     @staticmethod
     def fields_and_attrs(type: asdl.Constructor | asdl.Product) -> typing.List[asdl.Field]:
         if isinstance(type, asdl.Constructor):
@@ -76,11 +112,11 @@ class _helpers:
             return f"sequence<{raw_type}>"
 
         if field.opt:
-            if field.type in builtin_types:
+            if _helpers.is_by_value(field.type):
                 return f"std::optional<{raw_type}>"
             return f"maybe<{raw_type}>"
         
-        if field.type in builtin_types:
+        if _helpers.is_by_value(field.type):
             return raw_type
         return f"field<{raw_type}>"
     
@@ -95,6 +131,78 @@ class _helpers:
     def type_name(type: str) -> str:
         return builtin_types.get(type, type)
     
+    @staticmethod
+    def flat_type_name(type: str) -> str:
+        if type in flat_builtin_types:
+            return flat_builtin_types[type]
+        
+        if _helpers.is_by_value(type):
+            return _helpers.type_name(type)
+        
+        if type in complex_sums:
+            return f"node_ref<{type}>"
+        
+        return f"ref<{type}>"
+    
+    @staticmethod
+    def flat_field_type(field: asdl.Field) -> str:
+        raw_type: str = _helpers.flat_type_name(field.type)
+        
+        if field.seq:
+            return f"slice<{raw_type}>"
+        
+        if field.opt and not raw_type.startswith(("ref<", "node_ref<")):
+            return f"std::optional<{raw_type}>"
+        
+        return raw_type
+    
+    @staticmethod
+    def flat_rows(module: asdl.Module) -> typing.List[typing.Tuple[str, typing.List[asdl.Field]]]:
+        """
+        Returns (name, fields) for every row type of the flat AST.
+        Alternatives of a sum carry the sum's attributes as well.
+        """
+        
+        rows = []
+        
+        for type in module.dfns:
+            value = type.value
+            
+            if isinstance(value, asdl.Product):
+                rows.append((type.name, _helpers.fields_and_attrs(value)))
+            elif isinstance(value, asdl.Sum) and type.name in complex_sums:
+                for alt in value.types:
+                    rows.append((alt.name, alt.fields + value.attributes))
+        
+        return rows
+    
+    @staticmethod
+    def flat_pool_types(module: asdl.Module) -> typing.List[str]:
+        """
+        Returns the element types of all the sequence pools of the flat AST.
+        The character pool (for strings) is always present.
+        """
+        
+        result: typing.List[str] = []
+        
+        for _, fields in _helpers.flat_rows(module):
+            for field in fields:
+                if not field.seq:
+                    continue
+                
+                elem_type: str = _helpers.flat_type_name(field.type)
+                if elem_type not in result:
+                    result.append(elem_type)
+        
+        if "char" not in result:
+            result.append("char")
+        
+        return result
+    
+    @staticmethod
+    def kind_bits(sum_type: asdl.Sum) -> int:
+        return max(1, (len(sum_type.types) - 1).bit_length())
+    
     # @staticmethod
     # def all_abstract_names(module: asdl.Module) -> typing.List[str]:
     #     return [type.name for type in module.dfns]
@@ -111,6 +219,14 @@ def register_aliases(module: asdl.Module) -> None:
         builtin_types[type.name] = type.value.native_type
 
 
+def register_simple_sums(module: asdl.Module) -> None:
+    for type in module.dfns:
+        if _helpers.is_simple_sum(type.value):
+            simple_sums.add(type.name)
+        elif isinstance(type.value, asdl.Sum):
+            complex_sums.add(type.name)
+
+
 def main():
     args = parser.parse_args()
     
@@ -120,6 +236,7 @@ def main():
     asdl_module: asdl.Module = asdl.parse(asdl_file)
     
     register_aliases(asdl_module)  # TODO: Handle differently?
+    register_simple_sums(asdl_module)
     
     assert asdl.check(asdl_module, builtin_types)
     
@@ -130,6 +247,8 @@ def main():
         asdl_module=asdl_module,
         asdl=asdl,
         helpers=_helpers,
+        # Identifies the node layout, e.g. for invalidating serialized flat trees
+        schema_hash="0x" + hashlib.blake2b(asdl_file.read_bytes(), digest_size=8).hexdigest(),
     ))
     
     render_tpl(
@@ -137,6 +256,12 @@ def main():
         "ast_nodes.tpl.hpp",
         output_dir / "include/bondrewd/ast/ast_nodes.gen.hpp",
     )
+    
+    render_tpl(
+        env,
+        "ast_flat.tpl.hpp",
+        output_dir / "include/bondrewd/ast/ast_flat.gen.hpp",
+    )
 
 
 if __name__ == "__main__":
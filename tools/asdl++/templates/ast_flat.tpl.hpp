@@ -0,0 +1,600 @@
+{{ _autogenerated_ }}
+#pragma once
+
+#include <bondrewd/internal/common.hpp>
+#include <bondrewd/ast/ast.hpp>
+#include <bondrewd/ast/flat.hpp>
+#include <bondrewd/lex/token.hpp>
+#include <bondrewd/ast/ast_nodes.gen.hpp>
+
+#include <tuple>
+#include <array>
+#include <vector>
+#include <span>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <unordered_map>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <stdexcept>
+
+
+namespace bondrewd::ast::flat {
+
+
+{%- set rows = helpers.flat_rows(asdl_module) %}
+{%- set pool_types = helpers.flat_pool_types(asdl_module) %}
+{%- set root = asdl_module.dfns[0] %}
+
+
+{%- macro gen_row(name, fields) %}
+struct {{ name }} {
+    #pragma region Constants and typedefs
+    static constexpr const char *node_name = "{{ name }}";
+
+    static constexpr std::array<const char *, {{ fields | length }}> field_names{
+        {%- for field in fields %}"{{ field.name }}"{%- if not loop.last %}, {% endif %}{% endfor -%}
+    };
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    {%- for field in fields %}
+    {{ helpers.flat_field_type(field) }} {{ field.name }}{};
+    {%- endfor %}
+    #pragma endregion Fields
+
+    #pragma region Uniform fields access
+    auto get_fields_tuple() {
+        return std::tie(
+            {%- for field in fields %}
+            {{- field.name }}
+            {%- if not loop.last %}, {% endif %}
+            {%- endfor -%}
+        );
+    }
+
+    auto get_fields_tuple() const {
+        return std::tie(
+            {%- for field in fields %}
+            {{- field.name }}
+            {%- if not loop.last %}, {% endif %}
+            {%- endfor -%}
+        );
+    }
+    #pragma endregion Uniform fields access
+};
+{%- endmacro %}
+
+
+{%- macro gen_row_init(name, fields, prefix) %}
+{{- name }}{
+{%- for field in fields %}convert({{ prefix[field.name] if field.name in prefix else "alt" }}.{{ field.name }}){%- if not loop.last %}, {% endif %}{% endfor -%}
+}
+{%- endmacro %}
+
+
+#pragma region Forward declarations
+{%- for asdl_type in asdl_module.dfns if not helpers.is_simple_sum(asdl_type.value) and asdl_type.value is not instanceof asdl.Alias %}
+struct {{ asdl_type.name }};
+{%- endfor %}
+{%- for name, fields in rows if name is not in helpers.names_of_dfns(asdl_module) %}
+struct {{ name }};
+{%- endfor %}
+#pragma endregion Forward declarations
+
+
+#pragma region Sum kinds
+// Sums only exist as tags for node_ref; their alternatives are the actual rows
+{%- for asdl_type in asdl_module.dfns if asdl_type.value is instanceof asdl.Sum and not helpers.is_simple_sum(asdl_type.value) %}
+struct {{ asdl_type.name }} {
+    static constexpr unsigned kind_bits = {{ helpers.kind_bits(asdl_type.value) }};
+
+    enum class kind_t : uint8_t {
+        {%- for alt in asdl_type.value.types %}
+        {{ alt.name }} = {{ loop.index0 }},
+        {%- endfor %}
+    };
+};
+{{- "\n" if not loop.last else "" }}
+{%- endfor %}
+#pragma endregion Sum kinds
+
+
+#pragma region Rows
+{%- for name, fields in rows %}
+{{- gen_row(name, fields) }}
+{{- "\n" if not loop.last else "" }}
+{%- endfor %}
+#pragma endregion Rows
+
+
+#pragma region Visiting
+/**
+ * Dispatches on the kind of a node_ref. Works for any view with the same
+ * get_rows as Tree, e.g. a MappedTree.
+ */
+{%- for asdl_type in asdl_module.dfns if asdl_type.value is instanceof asdl.Sum and not helpers.is_simple_sum(asdl_type.value) %}
+template <typename View, typename F>
+decltype(auto) visit_node(const View &view, node_ref<{{ asdl_type.name }}> node, F &&func) {
+    assert(node);
+
+    switch (node.kind()) {
+        {%- for alt in asdl_type.value.types %}
+        case {{ asdl_type.name }}::kind_t::{{ alt.name }}:
+            return std::invoke(std::forward<F>(func), view.template get_rows<{{ alt.name }}>()[node.index()]);
+        {%- endfor %}
+        default:
+            throw std::logic_error("Invalid {{ asdl_type.name }} kind");
+    }
+}
+{{- "\n" if not loop.last else "" }}
+{%- endfor %}
+#pragma endregion Visiting
+
+
+#pragma region TreeDumper
+/**
+ * Prints a tree in a human-readable form.
+ *
+ * Only needs read access through get_rows and operator[], so it works both
+ * for a Tree and for a MappedTree, without loading the latter.
+ */
+template <typename View>
+class TreeDumper {
+public:
+    #pragma region Constructors
+    TreeDumper(const View &view, std::ostream &stream) :
+        view{&view}, stream{&stream} {}
+    #pragma endregion Constructors
+
+    #pragma region API
+    template <typename Root>
+    std::ostream &dump(const Root &root) {
+        if (root) {
+            dump_value(root);
+        } else {
+            *stream << "<empty>";
+        }
+
+        return *stream << "\n";
+    }
+    #pragma endregion API
+
+protected:
+    #pragma region Fields
+    const View *view;
+    std::ostream *stream;
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    template <typename T>
+    void dump_value(const T &value) {
+        if constexpr (is_node_ref<T>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            visit_node(*view, value, [&](const auto &row) { dump_row(row); });
+        } else if constexpr (std::same_as<T, ref<identifier>>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            *stream << (*view)[value];
+        } else if constexpr (is_ref<T>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            dump_row((*view)[value]);
+        } else if constexpr (std::same_as<T, slice<char>>) {
+            auto chars = (*view)[value];
+
+            *stream << std::quoted(std::string_view{chars.data(), chars.size()});
+        } else if constexpr (is_slice<T>) {
+            *stream << "[";
+
+            bool first = true;
+            for (const auto &item : (*view)[value]) {
+                if (!first) {
+                    *stream << ", ";
+                }
+                first = false;
+
+                dump_value(item);
+            }
+
+            *stream << "]";
+        } else if constexpr (util::specialization_of<T, std::optional>) {
+            if (!value) {
+                *stream << "null";
+                return;
+            }
+
+            dump_value(*value);
+        } else if constexpr (std::same_as<T, constant>) {
+            std::visit([&](const auto &item) { dump_value(item); }, value);
+        } else if constexpr (std::same_as<T, std::monostate>) {
+            *stream << "()";
+        } else if constexpr (std::same_as<T, bool>) {
+            *stream << (value ? "true" : "false");
+        } else if constexpr (std::is_enum_v<T>) {
+            *stream << to_string(value);
+        } else if constexpr (requires { value.dump(*stream); }) {
+            value.dump(*stream);
+        } else {
+            *stream << value;
+        }
+    }
+
+    template <typename Row>
+    void dump_row(const Row &row) {
+        *stream << Row::node_name << "(";
+
+        size_t idx = 0;
+        std::apply([&](const auto &... fields) {
+            ((*stream << (idx ? ", " : "") << Row::field_names[idx] << "=",
+              dump_value(fields), ++idx), ...);
+        }, row.get_fields_tuple());
+
+        *stream << ")";
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion TreeDumper
+
+
+#pragma region Tree
+/**
+ * A whole AST, stored as a struct of arrays.
+ *
+ * Every row type has its own contiguous array, and children are referenced
+ * by 32-bit indices into them (see ref and node_ref). Sequences and strings
+ * are slices of shared per-element-type pools. Identifiers are indices into
+ * the tree's own identifier table, so apart from it (and raw tokens), the
+ * whole tree is plain data that can be copied around in bulk.
+ *
+ * Rows are appended in post-order, i.e. children always precede their parents.
+ */
+class Tree {
+public:
+    #pragma region Constants and typedefs
+    using rows_t = std::tuple<
+        {%- for name, fields in rows %}
+        std::vector<{{ name }}>{{ "," if not loop.last else "" }}
+        {%- endfor %}
+    >;
+
+    using pools_t = std::tuple<
+        {%- for pool_type in pool_types %}
+        std::vector<{{ pool_type }}>{{ "," if not loop.last else "" }}
+        {%- endfor %}
+    >;
+
+    /// Changes whenever the ASDL definition does
+    static constexpr uint64_t schema_hash = {{ schema_hash }};
+    #pragma endregion Constants and typedefs
+
+    #pragma region Fields
+    {{ helpers.flat_type_name(root.name) }} root{};
+    #pragma endregion Fields
+
+    #pragma region Constructors
+    Tree() = default;
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    Tree(const Tree &) = default;
+    Tree(Tree &&) = default;
+    Tree &operator=(const Tree &) = default;
+    Tree &operator=(Tree &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Storage access
+    template <typename T>
+    std::vector<T> &get_rows() {
+        return std::get<std::vector<T>>(rows);
+    }
+
+    template <typename T>
+    const std::vector<T> &get_rows() const {
+        return std::get<std::vector<T>>(rows);
+    }
+
+    template <typename T>
+    std::vector<T> &get_pool() {
+        return std::get<std::vector<T>>(pools);
+    }
+
+    template <typename T>
+    const std::vector<T> &get_pool() const {
+        return std::get<std::vector<T>>(pools);
+    }
+
+    rows_t &get_all_rows() {
+        return rows;
+    }
+
+    const rows_t &get_all_rows() const {
+        return rows;
+    }
+
+    pools_t &get_all_pools() {
+        return pools;
+    }
+
+    const pools_t &get_all_pools() const {
+        return pools;
+    }
+
+    std::vector<identifier> &get_identifiers() {
+        return identifiers;
+    }
+
+    const std::vector<identifier> &get_identifiers() const {
+        return identifiers;
+    }
+    #pragma endregion Storage access
+
+    #pragma region Dereferencing
+    template <typename T>
+    const T &operator[](ref<T> node) const {
+        assert(node);
+
+        return get_rows<T>()[node.index];
+    }
+
+    const identifier &operator[](ref<identifier> name) const {
+        assert(name);
+
+        return identifiers[name.index];
+    }
+
+    template <typename T>
+    std::span<const T> operator[](slice<T> items) const {
+        return std::span<const T>{get_pool<T>()}.subspan(items.offset, items.size);
+    }
+
+    std::string_view get_string(slice<char> chars) const {
+        auto span = (*this)[chars];
+
+        return std::string_view{span.data(), span.size()};
+    }
+    #pragma endregion Dereferencing
+
+    #pragma region Visiting
+    {%- for asdl_type in asdl_module.dfns if asdl_type.value is instanceof asdl.Sum and not helpers.is_simple_sum(asdl_type.value) %}
+    template <typename F>
+    decltype(auto) visit(node_ref<{{ asdl_type.name }}> node, F &&func) const {
+        return visit_node(*this, node, std::forward<F>(func));
+    }
+    {{- "\n" if not loop.last else "" }}
+    {%- endfor %}
+    #pragma endregion Visiting
+
+    #pragma region API
+    size_t get_node_count() const {
+        return std::apply([](const auto &... arrays) {
+            return (arrays.size() + ... + 0);
+        }, rows);
+    }
+
+    /// Approximate, counts only the used part of the arrays
+    size_t get_memory_usage() const {
+        auto array_size = [](const auto &array) {
+            return array.size() * sizeof(typename std::decay_t<decltype(array)>::value_type);
+        };
+
+        size_t result = identifiers.size() * sizeof(identifier);
+
+        std::apply([&](const auto &... arrays) { result += (array_size(arrays) + ... + 0); }, rows);
+        std::apply([&](const auto &... arrays) { result += (array_size(arrays) + ... + 0); }, pools);
+
+        return result;
+    }
+
+    void clear() {
+        root = {};
+        std::apply([](auto &... arrays) { (arrays.clear(), ...); }, rows);
+        std::apply([](auto &... arrays) { (arrays.clear(), ...); }, pools);
+        identifiers.clear();
+    }
+    #pragma endregion API
+
+    #pragma region Debug
+    std::ostream &dump(std::ostream &stream = std::cout) const {
+        return TreeDumper<Tree>{*this, stream}.dump(root);
+    }
+    #pragma endregion Debug
+
+protected:
+    #pragma region Fields
+    rows_t rows{};
+    pools_t pools{};
+    std::vector<identifier> identifiers{};
+    #pragma endregion Fields
+
+};
+#pragma endregion Tree
+
+
+#pragma region Flattener
+/**
+ * Converts the pointer-based AST (ast::nodes) into a flat Tree.
+ */
+class Flattener {
+public:
+    #pragma region Constructors
+    explicit Flattener(Tree &tree) :
+        tree{&tree} {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    Flattener(const Flattener &) = delete;
+    Flattener(Flattener &&) = default;
+    Flattener &operator=(const Flattener &) = delete;
+    Flattener &operator=(Flattener &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Pointers
+    // Note: these have to precede the nodes, since their return types are deduced
+    template <is_ast_ptr T>
+    auto convert(const T &value) {
+        if constexpr (is_sequence<T>) {
+            using item_t = decltype(convert(std::declval<const typename T::element_type::value_type &>()));
+
+            if (!value) {
+                return slice<item_t>{};
+            }
+
+            std::vector<item_t> items{};
+            items.reserve(value->size());
+
+            // Children have to be converted first, since they may append to the same pool
+            for (const auto &item : *value) {
+                items.push_back(convert(item));
+            }
+
+            return push_slice(tree->get_pool<item_t>(), std::span<const item_t>{items});
+        } else {
+            using result_t = decltype(convert(*value));
+
+            if (!value) {
+                return result_t{};
+            }
+
+            return convert(*value);
+        }
+    }
+
+    template <typename T>
+    auto convert(const std::optional<T> &value) {
+        using result_t = decltype(convert(std::declval<const T &>()));
+
+        if constexpr (nullable<result_t>) {
+            return value ? convert(*value) : result_t{};
+        } else {
+            return value ? std::optional<result_t>{convert(*value)} : std::nullopt;
+        }
+    }
+    #pragma endregion Pointers
+
+    #pragma region Basic types
+    ref<identifier> convert(const identifier &name) {
+        auto [it, inserted] = identifier_indices.try_emplace(name, (index_t)tree->get_identifiers().size());
+
+        if (inserted) {
+            tree->get_identifiers().push_back(name);
+        }
+
+        return ref<identifier>{it->second};
+    }
+
+    slice<char> convert(const std::string &text) {
+        return push_slice(tree->get_pool<char>(), std::span<const char>{text.data(), text.size()});
+    }
+
+    constant convert(const ast::constant &value) {
+        return std::visit([&](const auto &item) -> constant {
+            if constexpr (std::same_as<std::decay_t<decltype(item)>, std::string>) {
+                return convert(item);
+            } else {
+                return item;
+            }
+        }, value);
+    }
+
+    lex::Token convert(const lex::Token &token) {
+        return token;
+    }
+
+    template <typename T>
+    requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    T convert(T value) {
+        return value;
+    }
+    #pragma endregion Basic types
+
+    #pragma region Nodes
+    {%- for asdl_type in asdl_module.dfns if not helpers.is_simple_sum(asdl_type.value) and asdl_type.value is not instanceof asdl.Alias %}
+    {%- if asdl_type.value is instanceof asdl.Sum and not helpers.is_simple_sum(asdl_type.value) %}
+    {%- set attr_prefix = dict() %}
+    {%- for attr in asdl_type.value.attributes %}
+    {%- set _ = attr_prefix.update({attr.name: "node"}) %}
+    {%- endfor %}
+    node_ref<{{ asdl_type.name }}> convert(const nodes::{{ asdl_type.name }} &node) {
+        switch (node.value.index()) {
+            {%- for alt in asdl_type.value.types %}
+            case {{ loop.index0 }}: {
+                [[maybe_unused]] const auto &alt = std::get<{{ loop.index0 }}>(node.value);
+                return add<{{ asdl_type.name }}>(
+                    {{ asdl_type.name }}::kind_t::{{ alt.name }},
+                    {{ gen_row_init(alt.name, alt.fields + asdl_type.value.attributes, attr_prefix) }}
+                );
+            }
+            {%- endfor %}
+            default:
+                throw std::logic_error("Empty {{ asdl_type.name }} node");
+        }
+    }
+    {%- elif asdl_type.value is instanceof asdl.Product %}
+    {%- set node_prefix = dict() %}
+    {%- for field in helpers.fields_and_attrs(asdl_type.value) %}
+    {%- set _ = node_prefix.update({field.name: "node"}) %}
+    {%- endfor %}
+    ref<{{ asdl_type.name }}> convert(const nodes::{{ asdl_type.name }} &node) {
+        return add({{ gen_row_init(asdl_type.name, helpers.fields_and_attrs(asdl_type.value), node_prefix) }});
+    }
+    {%- endif %}
+    {{- "\n" if not loop.last else "" }}
+    {%- endfor %}
+    #pragma endregion Nodes
+
+protected:
+    #pragma region Fields
+    Tree *tree;
+    std::unordered_map<identifier, index_t> identifier_indices{};
+    #pragma endregion Fields
+
+    #pragma region Helpers
+    template <typename Sum, typename Row>
+    node_ref<Sum> add(typename Sum::kind_t kind, Row row) {
+        return node_ref<Sum>::make(kind, push_row(tree->get_rows<Row>(), std::move(row)));
+    }
+
+    template <typename Row>
+    ref<Row> add(Row row) {
+        return ref<Row>{push_row(tree->get_rows<Row>(), std::move(row))};
+    }
+    #pragma endregion Helpers
+
+};
+#pragma endregion Flattener
+
+
+#pragma region flatten
+inline Tree flatten(const nodes::{{ root.name }} &root) {
+    Tree tree{};
+
+    tree.root = Flattener{tree}.convert(root);
+
+    return tree;
+}
+
+inline Tree flatten(const field<nodes::{{ root.name }}> &root) {
+    if (!root) {
+        return Tree{};
+    }
+
+    return flatten(*root);
+}
+#pragma endregion flatten
+
+
+}  // namespace bondrewd::ast::flat
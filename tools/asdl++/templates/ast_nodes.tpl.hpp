@@ -119,6 +119,25 @@ public:
 {%- endmacro %}
 
 
+{%- macro gen_enum(name, asdl_type) %}
+{#- Simple sum = enum class, stored by value #}
+enum class {{ name }} : uint8_t {
+    {%- for alt in asdl_type.types %}
+    {{ alt.name }} = {{ loop.index0 }},
+    {%- endfor %}
+};
+
+constexpr const char *to_string({{ name }} value) noexcept {
+    switch (value) {
+        {%- for alt in asdl_type.types %}
+        case {{ name }}::{{ alt.name }}: return "{{ alt.name }}";
+        {%- endfor %}
+        default: return "<unknown>";
+    }
+}
+{%- endmacro %}
+
+
 {%- macro gen_ctor(name, fields, value_arg_types=None) %}
 {%- if value_arg_types is none %}
 {%- set value_arg = "" %}
@@ -151,7 +170,7 @@ public:
 
 
 #pragma region Forward declarations
-{%- for asdl_type in asdl_module.dfns %}
+{%- for asdl_type in asdl_module.dfns if not helpers.is_simple_sum(asdl_type.value) %}
 class {{ asdl_type.name }};
 {%- if asdl_type.value is instanceof asdl.Sum %}
 {%- for alt in asdl_type.value.types %}
@@ -162,8 +181,17 @@ class {{ alt.name }};
 #pragma endregion Forward declarations
 
 
+#pragma region Enumerations
+// Enum-like sums are defined upfront, since other nodes store them by value
+{%- for asdl_type in asdl_module.dfns if helpers.is_simple_sum(asdl_type.value) %}
+{{- gen_enum(asdl_type.name, asdl_type.value) }}
+{{- "\n\n" if not loop.last else "" }}
+{%- endfor %}
+#pragma endregion Enumerations
+
+
 #pragma region Implementations
-{%- for asdl_type in asdl_module.dfns %}
+{%- for asdl_type in asdl_module.dfns if not helpers.is_simple_sum(asdl_type.value) %}
 {{- gen_class(asdl_type.name, asdl_type.value) }}
 {{- "\n\n" if not loop.last else "" }}
 {%- endfor %}
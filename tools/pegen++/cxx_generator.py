@@ -211,10 +211,20 @@ class CXXCallMakerVisitor(GrammarVisitor):
         )
         return self.cache[node]
 
+    # Unbound tokens are only checked for, so they don't need to be materialized
+    ACCEPT_FUNCTIONS: typing.Final[typing.Dict[str, str]] = {
+        "lexer.expect().token": "lexer.expect().accept",
+        "lexer.expect().keyword": "lexer.expect().accept",
+        "lexer.expect().punct": "lexer.expect().accept",
+        "lexer.expect().soft_keyword": "lexer.expect().accept_soft_keyword",
+    }
+
     def visit_NamedItem(self, node: NamedItem) -> FunctionCall:
         call: FunctionCall = self.generate_call(node.item)
         if node.name:
             call.assigned_variable = node.name
+        elif call.function in self.ACCEPT_FUNCTIONS:
+            call.function = self.ACCEPT_FUNCTIONS[call.function]
         return call
 
     def lookahead_call_helper(self, node: Lookahead, positive: bool) -> FunctionCall:
@@ -417,12 +427,17 @@ class _DeducedType:
 class CXXTypeDeductionVisitor(GrammarVisitor):
     gen: CXXParserGenerator
     wrap_ast_types: bool
+    unwrapped_ast_types: typing.Set[str]
     rules_stack: typing.List[Rule]
     visited_rules: typing.Set[Rule]
     
     def __init__(self, parser_generator: CXXParserGenerator):
         self.gen = parser_generator
         self.wrap_ast_types = "wrap_ast_types" in self.gen.grammar.metas
+        # Types that are stored by value (such as enum-like sums), and thus never wrapped
+        self.unwrapped_ast_types = set(
+            (self.gen.grammar.metas.get("unwrapped_ast_types") or "").split()
+        )
         self.rules_stack = []
         self.visited_rules = set()
     
@@ -440,7 +455,8 @@ class CXXTypeDeductionVisitor(GrammarVisitor):
             s = literal_eval(s)
         if self.wrap_ast_types and (
             s.startswith("ast::") and
-            not s.startswith(("ast::field", "ast::maybe", "ast::sequence"))
+            not s.startswith(("ast::field", "ast::maybe", "ast::sequence")) and
+            s not in self.unwrapped_ast_types
         ):
             s = f"ast::field<{s}>"
         return s
@@ -681,6 +697,10 @@ class CXXParserGenerator(ParserGenerator, GrammarVisitor):
     def remove_level(self) -> None:
         self.print("--_level;")
 
+    def add_profiling(self, node: Rule) -> None:
+        # Before the cache lookup, so that hits are counted as well
+        self.print(f"PARSER_PROFILE_({node.name});")
+
     def add_return(self, ret_val: str, *,
                    ignore_cache: bool = False) -> None:
         assert not ret_val.startswith("std::move"), "Don't use explicit std::move in return statements"
@@ -727,6 +747,17 @@ class CXXParserGenerator(ParserGenerator, GrammarVisitor):
         # self.all_rules has failed me
         return list(sorted(self.all_rules.items(), key=lambda x: x[0]))
 
+    @functools.cached_property
+    def memo_rules(self) -> typing.List[str]:
+        """
+        The names of the rules with columns in the memo table, in column order.
+        """
+        
+        return [
+            name for name, rule in self.all_rules_sorted
+            if self.should_cache(rule, include_left_recursive=True)
+        ]
+
     @jinja_tpl_generator
     def gen_subheader(self) -> None:
         subheader = self.grammar.metas.get("subheader", "")
@@ -824,6 +855,7 @@ class CXXParserGenerator(ParserGenerator, GrammarVisitor):
                 
                 self.print("auto _state = tell();")
                 self.print("auto _res_state = tell();")
+                self.add_profiling(node)
                 
                 self.print(f"if (auto _cached = get_cached<RuleType::{node.name}>(_state)) {{")
                 with self.indent():
@@ -861,6 +893,10 @@ class CXXParserGenerator(ParserGenerator, GrammarVisitor):
         self.print("const auto _state = tell();")
         self.print("(void)_state;")
         
+        # Left-recursive leaders are profiled by their caching wrapper instead
+        if not (node.left_recursive and node.leader):
+            self.add_profiling(node)
+        
         if self.should_cache(node):
             self.print(f"if (auto _cached = get_cached<RuleType::{node.name}>(_state)) {{")
             with self.indent():
@@ -897,9 +933,10 @@ class CXXParserGenerator(ParserGenerator, GrammarVisitor):
         self.add_level()
         
         self.print("auto _state = tell();")
+        self.add_profiling(node)
 
         if self.should_cache(node):
-            self.print(f"if (auto _cached = get_cached(_state, RuleType::{node.name})) {{")
+            self.print(f"if (auto _cached = get_cached<RuleType::{node.name}>(_state)) {{")
             with self.indent():
                 self.add_return("*_cached", ignore_cache=True)
             self.print("}")
@@ -9,10 +9,12 @@ _DEPENDENCIES := \
 	$(_PEGEN_PATH)/templates/parser.tpl.cpp \
 	$(_PEGEN_PATH)/cxx_generator.py \
 	$(_PEGEN_PATH)/pegenxx.py \
+	$(_PEGEN_PATH)/memo_profile.py \
 	$(TOOLS_ROOT)/jinja_codegen.py \
 	$(CONFIG_GRAMMAR) \
 	$(CONFIG_KEYWORDS) \
-	$(CONFIG_PUNCTS)
+	$(CONFIG_PUNCTS) \
+	$(CONFIG_MEMO_PROFILE)
 
 
 GENERATED += $(_GENERATED)
@@ -23,4 +25,5 @@ $(_PEGEN_PATH)/custom_pegen_grammar_parser.py: $(_PEGEN_PATH)/custom_pegen_metag
 
 
 $(_GENERATED) : $(_DEPENDENCIES) $(_PEGEN_PATH)/custom_pegen_grammar_parser.py
-	$(PYTHON) $(_PEGEN_PATH)/pegenxx.py --grammar $(CONFIG_GRAMMAR) --keywords $(CONFIG_KEYWORDS) --puncts $(CONFIG_PUNCTS) --output $(PROJECT_ROOT)
+	$(PYTHON) $(_PEGEN_PATH)/pegenxx.py --grammar $(CONFIG_GRAMMAR) --keywords $(CONFIG_KEYWORDS) --puncts $(CONFIG_PUNCTS) --output $(PROJECT_ROOT) \
+		$(addprefix --memo-profile ,$(CONFIG_MEMO_PROFILE))
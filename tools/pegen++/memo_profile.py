@@ -0,0 +1,117 @@
+"""
+Profile-guided selection of the memoized rules.
+
+The profiles are written by a parser built with BONDREWD_PARSER_PROFILE
+(see `bondrewd --rule-profile` and include/bondrewd/parse/rule_profile.hpp).
+For every rule they tell how much work its repeated invocations at the same
+positions took, which is what memoizing it saves, and how many positions
+it was invoked at, which is how many results memoizing it stores.
+"""
+
+from __future__ import annotations
+
+import typing
+import pathlib
+from dataclasses import dataclass
+
+from pegen.grammar import Rule
+
+
+@dataclass
+class RuleStats:
+    calls: int = 0
+    positions: int = 0
+    repeats: int = 0
+    work: int = 0
+    repeated_work: int = 0
+
+    @classmethod
+    def from_fields(cls, fields: typing.Sequence[str]) -> RuleStats:
+        return cls(*map(int, fields))
+
+    def __iadd__(self, other: RuleStats) -> RuleStats:
+        self.calls += other.calls
+        self.positions += other.positions
+        self.repeats += other.repeats
+        self.work += other.work
+        self.repeated_work += other.repeated_work
+        return self
+
+    @property
+    def gain(self) -> float:
+        """
+        The rule invocations memoization saves per stored result.
+        """
+
+        return self.repeated_work / max(self.positions, 1)
+
+
+def read_profiles(paths: typing.Iterable[pathlib.Path]) -> typing.Dict[str, RuleStats]:
+    """
+    Reads and sums up several profiles (e.g. one per sample file).
+    """
+
+    result: typing.Dict[str, RuleStats] = {}
+
+    for path in paths:
+        with path.open("r") as f:
+            for line in f:
+                line = line.strip()
+                if not line or line.startswith("#"):
+                    continue
+
+                name, *fields = line.split()
+                result.setdefault(name, RuleStats())
+                result[name] += RuleStats.from_fields(fields)
+
+    return result
+
+
+def is_memo_candidate(rule: Rule) -> bool:
+    # Left-recursive rules are cached by their own machinery regardless,
+    # and helper rules can't be marked in the grammar anyway
+    return not rule.left_recursive and not rule.name.startswith("_")
+
+
+def apply_memo_profile(
+    rules: typing.Dict[str, Rule],
+    stats: typing.Dict[str, RuleStats],
+    threshold: float,
+    report: typing.TextIO,
+) -> None:
+    """
+    Sets the `memo` flags of the rules according to the profile.
+
+    Rules with no data in the profile keep their `(memo)` marks from the grammar.
+    """
+
+    print(f"{'rule':<32} {'calls':>10} {'positions':>10} {'repeats':>10} {'gain':>8}  memo", file=report)
+
+    for name, rule in sorted(rules.items()):
+        if not is_memo_candidate(rule):
+            continue
+
+        rule_stats: RuleStats | None = stats.get(name)
+
+        if rule_stats is None:
+            print(f"{name:<32} {'(no data)':>41}  {'yes' if rule.memo else 'no'}", file=report)
+            continue
+
+        was_memo: bool = bool(rule.memo)
+        rule.memo = rule_stats.gain >= threshold
+
+        change: str = "" if rule.memo == was_memo else (" (added)" if rule.memo else " (removed)")
+
+        print(
+            f"{name:<32} {rule_stats.calls:>10} {rule_stats.positions:>10} "
+            f"{rule_stats.repeats:>10} {rule_stats.gain:>8.2f}  {'yes' if rule.memo else 'no'}{change}",
+            file=report,
+        )
+
+
+__all__ = [
+    "RuleStats",
+    "read_profiles",
+    "is_memo_candidate",
+    "apply_memo_profile",
+]
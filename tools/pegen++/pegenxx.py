@@ -3,6 +3,7 @@ import typing
 import argparse
 import pathlib
 import dataclasses
+import hashlib
 
 import sys
 sys.path.append(str(pathlib.Path(__file__).parent.parent))
@@ -10,6 +11,7 @@ from jinja_codegen import *
 from token_listing import *
 
 from cxx_generator import CXXParserGenerator
+from memo_profile import read_profiles, apply_memo_profile
 from pegen.grammar import Grammar
 
 from custom_pegen_grammar_parser import parse_grammar
@@ -51,6 +53,23 @@ parser.add_argument(
     default=PROJECT_ROOT,
 )
 
+parser.add_argument(
+    "--memo-profile",
+    type=pathlib.Path,
+    action="append",
+    default=[],
+    help="A rule profile from `bondrewd --rule-profile` (with a BONDREWD_PARSER_PROFILE build). "
+         "If given, the memoized rules are picked from the profile instead of the grammar's `(memo)` marks. "
+         "May be repeated to sum up several profiles.",
+)
+
+parser.add_argument(
+    "--memo-threshold",
+    type=float,
+    help="The least rule invocations memoizing a rule has to save per stored result for it to be memoized.",
+    default=1.0,
+)
+
 
 def main():
     args = parser.parse_args()
@@ -75,10 +94,29 @@ def main():
         grammar,
         tokens_to_names,
         debug=True,
-    ).prepare()
+    )
+    
+    if args.memo_profile:
+        apply_memo_profile(
+            generator.all_rules,
+            read_profiles(args.memo_profile),
+            args.memo_threshold,
+            sys.stderr,
+        )
+    
+    generator.prepare()
     
     env = make_env()
     
+    grammar_digest = hashlib.blake2b(digest_size=8)
+    for source_file in (grammar_file, keywords_file, puncts_file):
+        grammar_digest.update(source_file.read_bytes())
+    
+    env.globals.update(dict(
+        # Identifies the accepted language, e.g. for invalidating cached ASTs
+        grammar_hash="0x" + grammar_digest.hexdigest(),
+    ))
+    
     render_tpl(
         env,
         "parser.tpl.hpp",
@@ -8,6 +8,12 @@
 #define PARSER_DBG_(...)
 #endif
 
+#if BONDREWD_PARSER_PROFILE
+#define PARSER_PROFILE_(RULE)  auto _profile_guard = _profile_rule(RuleType::RULE, _state)
+#else
+#define PARSER_PROFILE_(RULE)
+#endif
+
 
 namespace bondrewd::parse {
 
@@ -3,10 +3,11 @@
 
 #include <bondrewd/internal/common.hpp>
 #include <bondrewd/parse/parser_base.hpp>
+#include <bondrewd/parse/rule_profile.hpp>
 #include <bondrewd/ast/ast_nodes.gen.hpp>
 #include <bondrewd/lex/src_location.hpp>
 
-#include <map>
+#include <limits>
 #include <vector>
 #include <optional>
 #include <algorithm>
@@ -24,6 +25,11 @@ namespace bondrewd::parse {
 #pragma region Parser
 class Parser : public ParserBase<Parser> {
 public:
+    #pragma region Constants and typedefs
+    /// Changes whenever the grammar or its token listings do, e.g. for invalidating cached ASTs
+    static constexpr uint64_t grammar_hash = {{ grammar_hash }};
+    #pragma endregion Constants and typedefs
+
     #pragma region Constructors
     Parser(lex::Lexer lexer_) : ParserBase(std::move(lexer_)) {}
     #pragma endregion Constructors
@@ -42,13 +48,19 @@ public:
         if (!result) {
             auto &scanner = lexer.get_scanner();
 
-            lex::SrcLocation err_loc = scanner.tell();
+            lex::SrcLocation err_loc = lexer.get_furthest_location();
 
-            throw SyntaxError(fmt::format("Syntax error at {} (`{}`)", err_loc.to_string(), scanner.view_context(err_loc, 5)));
+            throw SyntaxError(fmt::format("Syntax error at {} (`{}`)", scanner.resolve(err_loc).to_string(), scanner.view_context(err_loc, 5)));
         }
 
         return *result;
     }
+
+    #if BONDREWD_PARSER_PROFILE
+    const RuleProfile &get_profile() const {
+        return _profile;
+    }
+    #endif
     #pragma endregion API
 
 protected:
@@ -85,6 +97,34 @@ protected:
     using rule_result_t = std::optional<rule_raw_result_t<R>>;
     #pragma endregion Rule types
 
+    #if BONDREWD_PARSER_PROFILE
+    #pragma region Profiling
+    static constexpr std::string_view RULE_NAMES[] = {
+        {%- for rulename, rule in generator.all_rules_sorted %}
+        "{{ rulename }}",
+        {%- endfor %}
+    };
+
+    RuleProfile _profile{std::vector<std::string_view>(std::begin(RULE_NAMES), std::end(RULE_NAMES))};
+
+    /// Records a rule invocation when it goes out of scope
+    struct _ProfileGuard {
+        RuleProfile &profile;
+        RuleType rule_type;
+        state_t state;
+        uint64_t mark;
+
+        ~_ProfileGuard() {
+            profile.leave((unsigned)rule_type, state, mark);
+        }
+    };
+
+    _ProfileGuard _profile_rule(RuleType rule_type, state_t state) {
+        return _ProfileGuard{_profile, rule_type, state, _profile.enter()};
+    }
+    #pragma endregion Profiling
+    #endif
+
     #pragma region Helpers
     bool lookahead(bool positive, auto rule_func) {
         auto guard = lexer.lookahead(positive);
@@ -110,6 +150,20 @@ protected:
     void seek(state_t state) {
         lexer.seek(state);
     }
+
+    /**
+     * For grammar actions: promises that the parser won't seek back before the current
+     * position, so the tokens and the memoized results before it can be dropped.
+     *
+     * Only valid where no enclosing rule can backtrack past here, like after a top-level statement.
+     */
+    template <typename U>
+    U _commit(U result) {
+        lexer.retire_before(tell());
+        _prune_caches(tell());
+
+        return result;
+    }
     #pragma endregion Helpers
 
     #pragma region Extras
@@ -120,13 +174,14 @@ protected:
 
     #pragma region Caching
     #pragma region CacheNode
+    /// A memoized hit
     template <RuleType rule_type>
     class CacheNode {
     public:
-        rule_result_t<rule_type> value;
+        rule_raw_result_t<rule_type> value;
         state_t end_state;
 
-        CacheNode(rule_result_t<rule_type> value, state_t end_state)
+        CacheNode(rule_raw_result_t<rule_type> value, state_t end_state)
             : value{std::move(value)}, end_state{std::move(end_state)} {}
         
         CacheNode(const CacheNode &) = delete;
@@ -137,16 +192,48 @@ protected:
     };
     #pragma endregion CacheNode
 
+    #pragma region Memo table
+    /**
+     * The memo table has a row of MEMO_SLOTS entries (one per memoized rule) for every state,
+     * starting at _memo_base. An entry is MEMO_ABSENT, MEMO_FAILED, or MEMO_HIT plus
+     * the index of the hit in the rule's cache. So a lookup is a couple of loads.
+     *
+     * Failures always end where they start, so they need no CacheNode.
+     */
+    using memo_entry_t = uint32_t;
+
+    static constexpr memo_entry_t MEMO_ABSENT = 0;
+    static constexpr memo_entry_t MEMO_FAILED = 1;
+    static constexpr memo_entry_t MEMO_HIT = 2;
+
+    static constexpr unsigned MEMO_SLOTS = {{ generator.memo_rules | length }};
+
+    static constexpr unsigned _memo_slot(RuleType rule_type) {
+        switch (rule_type) {
+        {%- for rulename in generator.memo_rules %}
+        case RuleType::{{ rulename }}:
+            return {{ loop.index0 }};
+        {%- endfor %}
+
+        default:
+            return MEMO_SLOTS;
+        }
+    }
+    #pragma endregion Memo table
+
     #pragma region Fields
+    std::vector<memo_entry_t> _memo{};
+    state_t _memo_base = 0;
+
     {% for rulename, rule in generator.all_rules_sorted -%}
     {% if generator.should_cache(rule, include_left_recursive=True) -%}
-    std::map<state_t, CacheNode<RuleType::{{ rulename }}>> cache_{{ rulename }}{};
+    std::vector<CacheNode<RuleType::{{ rulename }}>> cache_{{ rulename }}{};
     {% endif %}
     {%- endfor %}
     #pragma endregion Fields
 
     template <RuleType rule_type>
-    constexpr std::map<state_t, CacheNode<rule_type>> &_get_cache() {
+    constexpr std::vector<CacheNode<rule_type>> &_get_cache() {
         {%- for rulename, rule in generator.all_rules_sorted if generator.should_cache(rule, include_left_recursive=True) %}
         if constexpr (rule_type == RuleType::{{ rulename }}) {
             return cache_{{ rulename }};
@@ -159,25 +246,102 @@ protected:
 
     template <RuleType rule_type>
     std::optional<rule_result_t<rule_type>> get_cached(state_t state) {
-        auto &cache = _get_cache<rule_type>();
+        constexpr unsigned slot = _memo_slot(rule_type);
+        static_assert(slot < MEMO_SLOTS, "Uncachable rule type");
 
-        auto it = cache.find(state);
+        // States before _memo_base wrap around, so they are out of range too
+        const size_t idx = (state - _memo_base) * MEMO_SLOTS + slot;
 
-        if (it == cache.end()) {
+        if (idx >= _memo.size() || _memo[idx] == MEMO_ABSENT) {
             return std::nullopt;
         }
 
-        seek(it->second.end_state);
+        if (_memo[idx] == MEMO_FAILED) {
+            seek(state);
+
+            return rule_result_t<rule_type>{};
+        }
+
+        const auto &node = _get_cache<rule_type>()[_memo[idx] - MEMO_HIT];
+
+        seek(node.end_state);
 
-        return it->second.value;
+        return rule_result_t<rule_type>{node.value};
     }
 
     /// Updates, if present
     template <RuleType rule_type>
-    void store_cached(state_t state, rule_result_t<rule_type> result) {
+    void store_cached(state_t state, const rule_result_t<rule_type> &result) {
+        constexpr unsigned slot = _memo_slot(rule_type);
+        static_assert(slot < MEMO_SLOTS, "Uncachable rule type");
+
+        if (state < _memo_base) {
+            return;
+        }
+
+        const size_t idx = (state - _memo_base) * MEMO_SLOTS + slot;
+
+        if (idx >= _memo.size()) {
+            _memo.resize((idx / MEMO_SLOTS + 1) * MEMO_SLOTS, MEMO_ABSENT);
+        }
+
+        if (!result) {
+            assert(tell() == state);
+
+            _memo[idx] = MEMO_FAILED;
+            return;
+        }
+
+        auto &cache = _get_cache<rule_type>();
+
+        if (_memo[idx] >= MEMO_HIT) {
+            // Left-recursive rules grow their seeds in place
+            cache[_memo[idx] - MEMO_HIT] = CacheNode<rule_type>(*result, tell());
+            return;
+        }
+
+        assert(cache.size() < std::numeric_limits<memo_entry_t>::max() - MEMO_HIT);
+
+        _memo[idx] = MEMO_HIT + (memo_entry_t)cache.size();
+        cache.emplace_back(*result, tell());
+    }
+
+    /// Moves the hits still referenced by the memo table to the front of the cache
+    template <RuleType rule_type>
+    void _compact_cache() {
+        constexpr unsigned slot = _memo_slot(rule_type);
+
         auto &cache = _get_cache<rule_type>();
+        std::vector<CacheNode<rule_type>> kept{};
+
+        for (size_t idx = slot; idx < _memo.size(); idx += MEMO_SLOTS) {
+            if (_memo[idx] >= MEMO_HIT) {
+                kept.push_back(std::move(cache[_memo[idx] - MEMO_HIT]));
+                _memo[idx] = MEMO_HIT + (memo_entry_t)(kept.size() - 1);
+            }
+        }
+
+        cache = std::move(kept);
+    }
 
-        cache.insert_or_assign(state, CacheNode<rule_type>(std::move(result), tell()));
+    /// Drops the results memoized before state. Done in batches, since the rest are moved
+    void _prune_caches(state_t state) {
+        if (state <= _memo_base) {
+            return;
+        }
+
+        const size_t rows = std::min(state - _memo_base, _memo.size() / MEMO_SLOTS);
+
+        if (rows < _memo.size() / MEMO_SLOTS / 2) {
+            return;
+        }
+
+        _memo.erase(_memo.begin(), _memo.begin() + rows * MEMO_SLOTS);
+        _memo_base += rows;
+
+        {%- for rulename in generator.memo_rules %}
+        _compact_cache<RuleType::{{ rulename }}>();
+        {%- endfor %}
     }
     #pragma endregion Caching
 
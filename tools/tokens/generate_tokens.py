@@ -3,6 +3,7 @@ import typing
 import argparse
 import pathlib
 import dataclasses
+import itertools
 from ast import literal_eval
 
 import sys
@@ -47,6 +48,68 @@ parser.add_argument(
     default=PROJECT_ROOT,
 )
 
+parser.add_argument(
+    "--trie-style",
+    choices=("table", "switch"),
+    help="How to generate the tries: as transition tables with a driver loop, or as nested switches.",
+    default="table",
+)
+
+
+@dataclasses.dataclass
+class KeywordHash:
+    """
+    A perfect hash for the keywords, over their length, first and last characters:
+    `(len * a + first * b + last * c) & (table_size - 1)`
+    """
+    
+    table_size: int
+    multipliers: typing.Tuple[int, int, int]
+    min_length: int
+    max_length: int
+    # Keyword indices, or None for empty slots
+    slots: typing.List[typing.Optional[int]]
+    
+    MAX_MULTIPLIER: typing.ClassVar[int] = 32
+    MAX_TABLE_SIZE: typing.ClassVar[int] = 1024
+    
+    @staticmethod
+    def hash(word: str, multipliers: typing.Tuple[int, int, int], table_size: int) -> int:
+        a, b, c = multipliers
+        return (len(word) * a + ord(word[0]) * b + ord(word[-1]) * c) & (table_size - 1)
+    
+    @classmethod
+    def build(cls, words: typing.List[str]) -> KeywordHash:
+        assert words and all(words), "Keywords must be non-empty"
+        
+        table_size = 1
+        while table_size < len(words):
+            table_size *= 2
+        
+        while table_size <= cls.MAX_TABLE_SIZE:
+            for multipliers in itertools.product(range(cls.MAX_MULTIPLIER), repeat=3):
+                slots: typing.List[typing.Optional[int]] = [None] * table_size
+                
+                for idx, word in enumerate(words):
+                    slot = cls.hash(word, multipliers, table_size)
+                    
+                    if slots[slot] is not None:
+                        break
+                    
+                    slots[slot] = idx
+                else:
+                    return cls(
+                        table_size,
+                        multipliers,
+                        min(map(len, words)),
+                        max(map(len, words)),
+                        slots,
+                    )
+            
+            table_size *= 2
+        
+        raise ValueError("Couldn't find a perfect hash for the keywords")
+
 
 @dataclasses.dataclass
 class TokensInfo:
@@ -57,6 +120,7 @@ class TokensInfo:
     misc_trie: TrieInfo
     string_trie: TrieInfo
     block_comment_trie: TrieInfo
+    keyword_hash: KeywordHash
     
     @classmethod
     def process(cls, keywords: Listing, puncts: Listing) -> TokensInfo:
@@ -69,7 +133,8 @@ class TokensInfo:
         
         misc_trie.add_wordlist(LINE_COMMENTS, "line_comment")
         misc_trie.add_word(BLOCK_COMMENT[0], "block_comment")
-        misc_trie.add_wordlist(punct_lookup.keys(), "punct")
+        for punct in puncts:
+            misc_trie.add_word(punct.str_value, "punct", tag=f"Punct::{punct.name}")
         misc_trie.add_wordlist(STRING_QUOTES, "string_quote")
         
         string_trie.add_word("\\", "escape")  # A bit of a hack, actually
@@ -87,6 +152,7 @@ class TokensInfo:
             TrieInfo.from_trie(misc_trie),
             TrieInfo.from_trie(string_trie),
             TrieInfo.from_trie(block_comment_trie),
+            KeywordHash.build([keyword.str_value for keyword in keywords]),
         )
 
 
@@ -96,6 +162,7 @@ def main():
     keywords_file: pathlib.Path = args.keywords
     puncts_file: pathlib.Path = args.puncts
     output_dir: pathlib.Path = args.output
+    trie_style: str = args.trie_style
     
     keywords: typing.List[typing.Tuple[str, str]] = read_listing(keywords_file)
     puncts: typing.List[typing.Tuple[str, str]] = read_listing(puncts_file)
@@ -108,7 +175,8 @@ def main():
         env,
         "tokens.tpl.hpp",
         output_dir / "include/bondrewd/lex/tokens.gen.hpp",
-        tokens_info=tokens_info
+        tokens_info=tokens_info,
+        trie_style=trie_style,
     )
     
     render_tpl(
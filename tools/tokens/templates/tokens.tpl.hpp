@@ -6,6 +6,8 @@
 
 #include <string_view>
 #include <cstdio>
+#include <cstdint>
+#include <optional>
 #include <unordered_map>
 
 
@@ -35,6 +37,53 @@ extern const std::unordered_map<std::string_view, Punct> string_to_punct;
 extern const std::unordered_map<std::string_view, HardKeyword> string_to_keyword;
 
 
+#pragma region Keyword lookup
+{%- set keyword_hash = tokens_info.keyword_hash %}
+namespace _keyword_hash {
+
+
+inline constexpr uint8_t empty_slot = 0xFF;
+
+/// Indexed by HardKeyword
+inline constexpr std::string_view texts[] = {
+{%- for keyword in tokens_info.keywords %}
+    {{ keyword.quoted_value }},
+{%- endfor %}
+};
+
+inline constexpr uint8_t slots[{{ keyword_hash.table_size }}] = {
+{%- for row in keyword_hash.slots | batch(8) %}
+    {% for slot in row %}{{ "empty_slot" if slot is none else slot }},{{ " " if not loop.last else "" }}{% endfor %}
+{%- endfor %}
+};
+
+
+}  // namespace _keyword_hash
+
+
+/**
+ * Classifies a name as a hard keyword, using a generated perfect hash
+ * over its length, first and last characters.
+ */
+constexpr std::optional<HardKeyword> lookup_keyword(std::string_view text) noexcept {
+    if (text.size() < {{ keyword_hash.min_length }} || text.size() > {{ keyword_hash.max_length }}) {
+        return std::nullopt;
+    }
+
+    const unsigned hash = ((unsigned)text.size() * {{ keyword_hash.multipliers[0] }} +
+                           (unsigned char)text.front() * {{ keyword_hash.multipliers[1] }} +
+                           (unsigned char)text.back() * {{ keyword_hash.multipliers[2] }}) & {{ keyword_hash.table_size - 1 }};
+    const uint8_t index = _keyword_hash::slots[hash];
+
+    if (index == _keyword_hash::empty_slot || _keyword_hash::texts[index] != text) {
+        return std::nullopt;
+    }
+
+    return (HardKeyword)index;
+}
+#pragma endregion Keyword lookup
+
+
 {%- macro _walk_trie_node(node, depth=0) %}
     switch (scanner.cur()) {
     {%- for ch, child_node in node.children.items() %}
@@ -54,7 +103,7 @@ extern const std::unordered_map<std::string_view, HardKeyword> string_to_keyword
 {%- endmacro %}
 
 
-{%- macro gen_trie(name, trie_info, extra_args="") %}
+{%- macro gen_trie(name, trie_info, extra_args="", tag_type="") %}
 class {{ name }} {
 public:
     #pragma region Verdicts
@@ -89,7 +138,7 @@ public:
         scanner.advance({{ accepted_node.word | length }});
         {%- endif %}
         {%- filter indent(width=4) %}
-        {{- payload(accepted_node) }}
+        {{- payload(accepted_node.verdict, '"' ~ (accepted_node.word | cpp_escape) ~ '"', accepted_node.tag) }}
         {%- endfilter %}
         return Verdict::{{ accepted_node.verdict }};
         {%- endcall %}
@@ -101,25 +150,152 @@ public:
 {%- endmacro %}
 
 
-{% call(node) gen_trie("MiscTrie", tokens_info.misc_trie, extra_args="Punct *punct, std::string_view *quote") %}
-    {%- if node.verdict == "string_quote" %}
+{%- macro gen_dfa(name, trie_info, extra_args="", tag_type="") %}
+{%- set dfa = trie_info.dfa %}
+class {{ name }} {
+public:
+    #pragma region Verdicts
+    enum class Verdict {
+        {%- for verdict in trie_info.verdicts %}
+        {{ verdict }} = {{ loop.index0 }},
+        {%- endfor %}
+    };
+    #pragma endregion Verdicts 
+
+    #pragma region Constructors
+    {{ name }}() {}
+    #pragma endregion Constructors
+
+    #pragma region Service constructors
+    {{ name }}(const {{ name }} &) = default;
+    {{ name }}({{ name }} &&) = default;
+    {{ name }} &operator=(const {{ name }} &) = default;
+    {{ name }} &operator=({{ name }} &&) = default;
+    #pragma endregion Service constructors
+
+    #pragma region Interface
+    Verdict feed(Scanner &scanner{{ ', ' if extra_args }}{{ extra_args }}) {
+        auto start_pos = scanner.tell();
+
+        state_t state = root_state;
+        state_t accepted = dead_state;
+        size_t length = 0;
+        size_t accepted_length = 0;
+
+        while (scanner.cur() != Scanner::end_of_file) {
+            state = transitions[state][byte_classes[(unsigned char)scanner.cur()]];
+
+            if (state == dead_state) {
+                break;
+            }
+
+            scanner.advance();
+            ++length;
+
+            if (verdicts[state] != Verdict::{{ trie_info.verdicts[0] }}) {
+                accepted = state;
+                accepted_length = length;
+            }
+        }
+
+        if (accepted_length != length) {
+            // Back to the longest word seen
+            scanner.seek(start_pos);
+            scanner.advance(accepted_length);
+        }
+
+        const Verdict verdict = verdicts[accepted];
+
+        switch (verdict) {
+        {%- for verdict in trie_info.verdicts[1:] %}
+        {%- set payload = caller(verdict, "words[accepted]", "tags[accepted]") | trim %}
+        {%- if payload %}
+        case Verdict::{{ verdict }}: {
+            {{ payload | indent(width=8) }}
+        } break;
+        {%- endif %}
+        {%- endfor %}
+        default:
+            break;
+        }
+
+        return verdict;
+    }
+    #pragma endregion Interface
+
+protected:
+    #pragma region Tables
+    using state_t = {{ dfa.state_type }};
+
+    static constexpr state_t dead_state = 0;
+    static constexpr state_t root_state = 1;
+
+    static constexpr uint8_t byte_classes[256] = {
+        {%- for row in dfa.byte_classes | batch(16) %}
+        {% for byte_class in row %}{{ byte_class }},{{ " " if not loop.last else "" }}{% endfor %}
+        {%- endfor %}
+    };
+
+    static constexpr state_t transitions[{{ dfa.state_count }}][{{ dfa.class_count }}] = {
+        {%- for row in dfa.transitions %}
+        {{ "{" }}{% for next_state in row %}{{ next_state }}{{ ", " if not loop.last else "" }}{% endfor %}{{ "}" }},  // {{ loop.index0 }}: "{{ dfa.words[loop.index0] | cpp_escape }}"
+        {%- endfor %}
+    };
+
+    static constexpr Verdict verdicts[{{ dfa.state_count }}] = {
+        {%- for verdict in dfa.verdicts %}
+        Verdict::{{ verdict }},
+        {%- endfor %}
+    };
+
+    static constexpr std::string_view words[{{ dfa.state_count }}] = {
+        {%- for word in dfa.words %}
+        "{{ word | cpp_escape }}",
+        {%- endfor %}
+    };
+    {%- if tag_type %}
+
+    static constexpr {{ tag_type }} tags[{{ dfa.state_count }}] = {
+        {%- for tag in dfa.tags %}
+        {{ tag if tag is not none else tag_type ~ "{}" }},
+        {%- endfor %}
+    };
+    {%- endif %}
+    #pragma endregion Tables
+
+};
+
+{%- endmacro %}
+
+
+{%- macro gen_matcher(name, trie_info, extra_args="", tag_type="") %}
+{%- if trie_style == "table" %}
+{{- gen_dfa(name, trie_info, extra_args, tag_type, caller=caller) }}
+{%- else %}
+{{- gen_trie(name, trie_info, extra_args, tag_type, caller=caller) }}
+{%- endif %}
+{%- endmacro %}
+
+
+{% call(verdict, word, tag) gen_matcher("MiscTrie", tokens_info.misc_trie, extra_args="Punct *punct, std::string_view *quote", tag_type="Punct") %}
+    {%- if verdict == "string_quote" %}
     if (quote) {
-        *quote = "{{ node.word | cpp_escape }}";
+        *quote = {{ word }};
     }
-    {%- elif node.verdict == "punct" %}
+    {%- elif verdict == "punct" %}
     if (punct) {
-        *punct = Punct::{{ tokens_info.punct_lookup[node.word] }};  // TODO
+        *punct = {{ tag }};
     }
     {%- endif %}
 {% endcall %}
 
 
-{% call(node) gen_trie("StringTrie", tokens_info.string_trie, extra_args="std::string_view *quote, int *escape") %}
-    {%- if node.verdict == "end_quote" %}
+{% call(verdict, word, tag) gen_matcher("StringTrie", tokens_info.string_trie, extra_args="std::string_view *quote, int *escape") %}
+    {%- if verdict == "end_quote" %}
         if (quote) {
-            *quote = "{{ node.word | cpp_escape }}";
+            *quote = {{ word }};
         }
-    {%- elif node.verdict == "escape" %}
+    {%- elif verdict == "escape" %}
         if (escape) {
             *escape = scanner.cur();
             scanner.advance();
@@ -128,7 +304,7 @@ public:
 {% endcall %}
 
 
-{% call(node) gen_trie("BlockCommentTrie", tokens_info.block_comment_trie) %}
+{% call(verdict, word, tag) gen_matcher("BlockCommentTrie", tokens_info.block_comment_trie) %}
 {% endcall %}
 
 
@@ -42,6 +42,8 @@ class Node:
     parent: Node | None = None
     word: str = ""
     children: typing.Dict[str, Node] = dataclasses.field(default_factory=dict)
+    # A C++ expression attached to the word, for the generated code to use
+    tag: str | None = None
     # Fields below are autofilled
     index: int = None
     
@@ -94,7 +96,7 @@ class Trie:
         self._sentinel = Node(verdict_none, self)
         self._all_nodes = {self._root, self._sentinel}
     
-    def add_word(self, word: str, verdict: typing.Any) -> None:
+    def add_word(self, word: str, verdict: typing.Any, tag: str | None = None) -> None:
         verdict_none = self._verdict_none
         
         node = self._root
@@ -106,6 +108,7 @@ class Trie:
             raise ValueError(f"Word {word!r} already exists in the trie")
         
         node.verdict = verdict
+        node.tag = tag
     
     def add_wordlist(self, words: typing.Iterable[str], verdict: typing.Any) -> None:
         for word in words:
@@ -120,10 +123,81 @@ class Trie:
         return index
 
 
+@dataclasses.dataclass
+class DfaInfo:
+    """
+    The trie as a transition table, for a table-driven matcher.
+    
+    Bytes are grouped into classes that behave identically in every state,
+    with class 0 for the bytes no word uses. State 0 is the dead state,
+    and state 1 is the root.
+    """
+    
+    # Indexed by byte
+    byte_classes: typing.List[int]
+    class_count: int
+    # Indexed by state; each row has class_count entries
+    transitions: typing.List[typing.List[int]]
+    # The verdict and the word of each state, as if it were accepted
+    verdicts: typing.List[str]
+    words: typing.List[str]
+    tags: typing.List[str | None]
+    
+    @property
+    def state_count(self) -> int:
+        return len(self.transitions)
+    
+    @property
+    def state_type(self) -> str:
+        return "uint8_t" if self.state_count <= 0x100 else "uint16_t"
+    
+    @classmethod
+    def from_trie(cls, trie: Trie) -> DfaInfo:
+        verdict_none = trie._verdict_none
+        
+        # Breadth-first, so that the states of short words come first
+        nodes: typing.List[Node] = [trie._root]
+        for node in nodes:
+            nodes.extend(node.children.values())
+        
+        state_of: typing.Dict[Node, int] = {node: idx + 1 for idx, node in enumerate(nodes)}
+        
+        columns: typing.Dict[int, typing.Tuple[int, ...]] = {}
+        for byte in range(0x100):
+            column = tuple(state_of.get(node.children.get(chr(byte)), 0) for node in nodes)
+            
+            if any(column):
+                columns[byte] = column
+        
+        class_of_column: typing.Dict[typing.Tuple[int, ...], int] = {}
+        byte_classes = [0] * 0x100
+        for byte, column in columns.items():
+            byte_classes[byte] = class_of_column.setdefault(column, len(class_of_column) + 1)
+        
+        class_count = len(class_of_column) + 1
+        
+        transitions = [[0] * class_count]
+        for idx, _ in enumerate(nodes):
+            row = [0] * class_count
+            for column, byte_class in class_of_column.items():
+                row[byte_class] = column[idx]
+            transitions.append(row)
+        
+        return cls(
+            byte_classes,
+            class_count,
+            transitions,
+            [verdict_none] + [node.verdict for node in nodes],
+            [""] + [node.word for node in nodes],
+            [None] + [node.tag for node in nodes],
+        )
+
+
 @dataclasses.dataclass
 class TrieInfo:
     verdicts: typing.List[str]
     root: Node
+    dfa: DfaInfo
     
     @classmethod
     def from_trie(cls, trie: Trie) -> TrieInfo:
@@ -139,4 +213,4 @@ class TrieInfo:
         
         verdicts = [trie._verdict_none] + list(sorted(verdicts))
         
-        return cls(verdicts, trie._root)
+        return cls(verdicts, trie._root, DfaInfo.from_trie(trie))